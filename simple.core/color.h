@@ -2,10 +2,11 @@
 
 #include "simple.h"
 #include "simpleMath.h"
+#include <type_traits>
 
 namespace simple
 {
-	struct color : public simpleStruct
+	struct color
 	{
 	public:
 		// base RGB components: (0, 1) -> (0, 255)
@@ -22,14 +23,6 @@ namespace simple
 			alpha = 0;
 		}
 
-		color(const color& color)
-		{
-			red = color.red;
-			green = color.green;
-			blue = color.blue;
-			alpha = color.alpha;
-		}
-
 		color(float ared, float agreen, float ablue, float aalpha)
 		{
 			red = ared;
@@ -166,14 +159,6 @@ namespace simple
 			return (red + green + blue + alpha) / 4.0f;
 		}
 
-		void operator=(const color& color)
-		{
-			red = color.red;
-			green = color.green;
-			blue = color.blue;
-			alpha = color.alpha;
-		}
-
 		void operator+(const color& color)
 		{
 			red = red + color.red;
@@ -278,12 +263,14 @@ namespace simple
 			return !compare(other);
 		}
 
-		size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(red, green, blue);
 		}
 	};
 
+	static_assert(std::is_trivially_copyable_v<color>, "color must remain trivially copyable");
+
 	struct colors
 	{
 	public:
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <concepts>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <type_traits>
 
 #include "simpleType.h"
+#include "simpleWyHash.h"
 
 namespace simple
 {
@@ -135,10 +137,22 @@ namespace simple
 	template<typename T>
 	concept isStdHashable = is_std_hashable<T>::value;
 
+	/// <summary>
+	/// Value types (points, pixels, edges, etc...) that provide a non-virtual getHash() without
+	/// deriving from simpleStruct. These stay trivially copyable (no vtable pointer), so they can
+	/// be packed tightly in simpleArray and copied with memcpy.
+	/// </summary>
+	template<typename T>
+	concept isHashableValue = requires(const T& value)
+	{
+		{ value.getHash() } -> std::convertible_to<size_t>;
+	};
+
 	template<typename T>
 	concept isHashable = std::convertible_to<T, simpleStruct> ||
 		std::convertible_to<T, simpleObject> ||
 		std::same_as<T, simpleString> ||
+		isHashableValue<T> ||
 		isStdHashable<T>;
 
 	template<typename T>
@@ -167,6 +181,9 @@ namespace simple
 			else if constexpr (std::convertible_to<T, simpleObject>)
 				nextHash = next.getHash();
 
+			else if constexpr (isHashableValue<T>)
+				nextHash = next.getHash();
+
 			else if constexpr (isStdHashable<T>)
 				nextHash = std::hash<T>{}(next);
 
@@ -250,6 +267,34 @@ namespace simple
 			hash_combine(result, values...);
 			return result;
 		}
+
+		/// <summary>
+		/// Seeded version of generateHash. The seed is mixed in before the values are combined; so
+		/// (with a random seed) the hash codes can't be predicted by the caller (HashDoS).
+		/// </summary>
+		template<isHashable ...T>
+		static size_t generateSeededHash(size_t seed, const T&...values)
+		{
+			size_t result = (size_t)simpleWyHash::mix((uint64_t)seed, 0x9e3779b97f4a7c15ull);
+			hash_combine(result, values...);
+			return result;
+		}
+
+		/// <summary>
+		/// Bulk hash of a contiguous byte range (strings, arrays of plain values, buffers)
+		/// </summary>
+		static size_t generateBytesHash(const void* data, size_t length)
+		{
+			return (size_t)simpleWyHash::hash(data, length);
+		}
+
+		/// <summary>
+		/// Seeded bulk hash of a contiguous byte range
+		/// </summary>
+		static size_t generateBytesHash(const void* data, size_t length, size_t seed)
+		{
+			return (size_t)simpleWyHash::hash(data, length, (uint64_t)seed);
+		}
 	};
 
 	struct default_value
@@ -267,6 +312,10 @@ namespace simple
 		}
 	};
 
+	/// <summary>
+	/// Cache line size (bytes) used to separate data written by different threads (false sharing)
+	/// </summary>
+	constexpr size_t simpleCacheLineSize = 64;
 
 	/// <summary>
 	/// Instructs the iterator to either continue or break out of its loop
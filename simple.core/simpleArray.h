@@ -2,10 +2,14 @@
 
 #include "simple.h"
 #include "simpleException.h"
+#include "simpleParallel.h"
 #include "simpleRange.h"
+#include "simpleSort.h"
+#include <cstring>
 #include <functional>
 #include <iosfwd>
 #include <limits>
+#include <type_traits>
 
 namespace simple
 {
@@ -45,6 +49,12 @@ namespace simple
 	template<isHashable T>
 	using simpleArrayComparer = std::function<int(const T& item1, const T& item2)>;
 
+	/// <summary>
+	/// Combines two partial aggregates (see parallelAggregate)
+	/// </summary>
+	template<typename TResult>
+	using simpleArrayCombiner = std::function<TResult(const TResult& aggregate1, const TResult& aggregate2)>;
+
 	/// <summary>
 	/// Selector delegate that transforms T->TResult by use of user function
 	/// </summary>
@@ -57,6 +67,9 @@ namespace simple
 	template<isHashable T, isNumber TResult>
 	using simpleArrayValueIndicator = std::function<TResult(const T& item)>;
 
+	template<isHashable T>
+	class simpleList;
+
 	template<isHashable T>
 	class simpleArray : public simpleObject
 	{
@@ -81,7 +94,7 @@ namespace simple
 
 	public:
 
-		const T* getArray();
+		const T* getArray() const;
 
 	public:
 
@@ -120,8 +133,41 @@ namespace simple
 		template<isNumber TResult>
 		TResult kadanesAlgorithm(simpleRange<int>& result, simpleArrayValueIndicator<T, TResult> valueIndicator);
 
+	public:	// Sorting:  sort returns a sorted (stable) copy; the others sort the array in place (see simpleSort)
+
+		simpleArray<T> sort(const simpleArrayComparer<T>& comparer) const;
+
+		void sortInPlace(const simpleArrayComparer<T>& comparer);
+		void stableSort(const simpleArrayComparer<T>& comparer);
+		void parallelSort(const simpleArrayComparer<T>& comparer);
+
+		template<isNumber TKey>
+		void radixSort(const simpleArraySelector<T, TKey>& keySelector);
+
+	public:	// Parallel (default thread pool; see simpleParallel). Callbacks are called concurrently.
+
+		void parallelForEach(const simpleArrayCallback<T>& callback) const;
+
+		template<isHashable TResult>
+		simpleArray<TResult> parallelSelect(const simpleArraySelector<T, TResult>& selector) const;
+
+		simpleArray<T> parallelWhere(const simpleArrayPredicate<T>& predicate) const;
+
+		/// <summary>
+		/// Aggregates chunks of the array in parallel (each from the seed); and combines the chunk
+		/// results in order. The seed must be an identity of the combiner (e.g. 0 for a sum).
+		/// </summary>
+		template<typename TResult>
+		TResult parallelAggregate(const TResult& seed, const simpleArrayAggregate<T, TResult>& aggregator, const simpleArrayCombiner<TResult>& combiner) const;
+
 	private:
 
+		template<isHashable TOther>
+		friend class simpleArray;
+
+		template<isHashable TOther>
+		friend class simpleList;
+
 		void allocate(int capacity);
 		void reAllocate(const T* anArray, int anArrayLength);
 
@@ -168,12 +214,7 @@ namespace simple
 		_array = nullptr;
 
 		if (copy.count() > 0)
-		{
-			allocate(copy.count());
-
-			for (int index = 0; index < copy.count(); index++)
-				this->set(index, copy.get(index));
-		}
+			reAllocate(copy._array, copy.count());
 	}
 
 	template<isHashable T>
@@ -254,13 +295,21 @@ namespace simple
 			_countAlloc = anArrayLength;
 		}
 
-		// Initialize new memory
-		int index = 0;
-
-		while (index < anArrayLength)
+		// Initialize new memory (value types without a vtable can be block copied)
+		if constexpr (std::is_trivially_copyable_v<T>)
 		{
-			newArray[index] = anArray[index];
-			index++;
+			if (anArrayLength > 0)
+				std::memcpy(newArray, anArray, sizeof(T) * anArrayLength);
+		}
+		else
+		{
+			int index = 0;
+
+			while (index < anArrayLength)
+			{
+				newArray[index] = anArray[index];
+				index++;
+			}
 		}
 
 		_array = newArray;
@@ -299,7 +348,7 @@ namespace simple
 	}
 
 	template<isHashable T>
-	const T* simpleArray<T>::getArray()
+	const T* simpleArray<T>::getArray() const
 	{
 		return _array;
 	}
@@ -315,12 +364,11 @@ namespace simple
 			_array = nullptr;
 		}
 
-		allocate(other.count());
+		if (other.count() > 0)
+			reAllocate(other._array, other.count());
 
-		for (int index = 0; index < other.count(); index++)
-		{
-			_array[index] = other.get(index);
-		}
+		else
+			allocate(0);
 	}
 
 	template<isHashable T>
@@ -356,24 +404,27 @@ namespace simple
 	template<isHashable T>
 	size_t simpleArray<T>::getHash() const
 	{
-		// Take hash of the pointer value (could easily just take the pointer itself!)
-		size_t hash = 0;
-
-		for (int index = 0; index < this->count(); index++)
+		// Plain values whose bytes define equality (char, int, etc...) are hashed in bulk. Floating
+		// point, and padded structs, are hashed per element (e.g. -0.0f == 0.0f)
+		if constexpr (std::has_unique_object_representations_v<T>)
 		{
-			size_t lastHash = hash;
+			return hashGenerator::generateBytesHash(_array, sizeof(T) * _count);
+		}
+		else
+		{
+			size_t hash = 0;
 
-			if (index == 0)
-				hash = hashGenerator::generateHash(this->get(index));
+			for (int index = 0; index < _count; index++)
+			{
+				if (index == 0)
+					hash = hashGenerator::generateHash(_array[index]);
 
-			else
-				hash = hashGenerator::combineHash(hash, this->get(index));
+				else
+					hash = hashGenerator::combineHash(hash, _array[index]);
+			}
 
-			if (hash == lastHash)
-				throw simpleException("Hash zero-value detected (this may cause a hash collision):  simpleArray.h");
+			return hash;
 		}
-
-		return hash;
 	}
 
 	template<isHashable T>
@@ -677,4 +728,76 @@ namespace simple
 		// Default
 		return maxSum;
 	}
+
+	template<isHashable T>
+	simpleArray<T> simpleArray<T>::sort(const simpleArrayComparer<T>& comparer) const
+	{
+		simpleArray<T> result(*this);
+
+		result.stableSort(comparer);
+
+		return result;
+	}
+
+	template<isHashable T>
+	void simpleArray<T>::sortInPlace(const simpleArrayComparer<T>& comparer)
+	{
+		simpleSort::introSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	void simpleArray<T>::stableSort(const simpleArrayComparer<T>& comparer)
+	{
+		simpleSort::stableSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	void simpleArray<T>::parallelSort(const simpleArrayComparer<T>& comparer)
+	{
+		simpleSort::parallelSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	template<isNumber TKey>
+	void simpleArray<T>::radixSort(const simpleArraySelector<T, TKey>& keySelector)
+	{
+		simpleSort::radixSort<T, TKey>(_array, _count, keySelector);
+	}
+
+	template<isHashable T>
+	void simpleArray<T>::parallelForEach(const simpleArrayCallback<T>& callback) const
+	{
+		simpleParallel::forEach(_array, _count, callback);
+	}
+
+	template<isHashable T>
+	template<isHashable TResult>
+	simpleArray<TResult> simpleArray<T>::parallelSelect(const simpleArraySelector<T, TResult>& selector) const
+	{
+		simpleArray<TResult> result(_count);
+
+		simpleParallel::select(_array, _count, result._array, selector);
+
+		return result;
+	}
+
+	template<isHashable T>
+	simpleArray<T> simpleArray<T>::parallelWhere(const simpleArrayPredicate<T>& predicate) const
+	{
+		std::vector<int> indices = simpleParallel::where(_array, _count, predicate);
+
+		simpleArray<T> result((int)indices.size());
+
+		for (int index = 0; index < (int)indices.size(); index++)
+			result._array[index] = _array[indices[index]];
+
+		return result;
+	}
+
+	template<isHashable T>
+	template<typename TResult>
+	TResult simpleArray<T>::parallelAggregate(const TResult& seed, const simpleArrayAggregate<T, TResult>& aggregator, const simpleArrayCombiner<TResult>& combiner) const
+	{
+		return simpleParallel::aggregate(_array, _count, seed, aggregator, combiner);
+	}
 }
\ No newline at end of file
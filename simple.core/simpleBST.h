@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 #include "simple.h"
+#include "simpleArray.h"
 #include "simpleBSTNode.h"
 #include "simpleException.h"
 #include "simpleHash.h"
@@ -48,8 +49,17 @@ namespace simple
 		bool containsKey(K key);
 		int count() const;
 
+		/// <summary>
+		/// Iterates the tree in key order (in-order traversal)
+		/// </summary>
 		void iterate(simpleHashCallback<K, T> callback) const;
 
+		/// <summary>
+		/// Iterates nodes with lowKey &lt;= key &lt;= highKey in key order. Only the sub-trees
+		/// that overlap the range are visited.
+		/// </summary>
+		void rangeIterate(K lowKey, K highKey, simpleHashCallback<K, T> callback) const;
+
 		T get(K key);
 		T search(K key);
 
@@ -60,6 +70,53 @@ namespace simple
 
 		void clear();
 
+		/// <summary>
+		/// Replaces the contents of the tree with the sorted (strictly increasing) keys, and their values,
+		/// in O(n). The tree is built perfectly balanced - no rotations are needed.
+		/// </summary>
+		void fromSorted(const simpleArray<K>& sortedKeys, const simpleArray<T>& values);
+
+	public:	// Ordered Queries:  (return nullptr when there is no such node)
+
+		/// <summary>
+		/// Returns the node with the smallest key that is greater than, or equal to, the search key
+		/// </summary>
+		const simpleBSTNode<K, T>* lowerBound(K searchKey) const;
+
+		/// <summary>
+		/// Returns the node with the smallest key that is greater than the search key
+		/// </summary>
+		const simpleBSTNode<K, T>* upperBound(K searchKey) const;
+
+		/// <summary>
+		/// Returns the node with the next key (greater than the search key). The search key need
+		/// not be in the tree.
+		/// </summary>
+		const simpleBSTNode<K, T>* successor(K searchKey) const;
+
+		/// <summary>
+		/// Returns the node with the previous key (less than the search key). The search key need
+		/// not be in the tree.
+		/// </summary>
+		const simpleBSTNode<K, T>* predecessor(K searchKey) const;
+
+	public:	// Order Statistics:  O(log n) using the sub-tree sizes
+
+		/// <summary>
+		/// Returns the number of keys less than the search key (the search key need not be in the tree)
+		/// </summary>
+		int rank(K searchKey) const;
+
+		/// <summary>
+		/// Returns the node with the k-th smallest key (zero-based)
+		/// </summary>
+		const simpleBSTNode<K, T>* select(int index) const;
+
+		/// <summary>
+		/// Returns the number of keys with lowKey &lt;= key &lt;= highKey
+		/// </summary>
+		int countInRange(K lowKey, K highKey) const;
+
 	public:
 
 		simpleString createOutput();
@@ -86,22 +143,23 @@ namespace simple
 				throw simpleException("Unhandled binary comparison operator:  simpleBST.h");
 		}
 
-		simpleBSTNode<K, T>* successor(K searchKey);
-		simpleBSTNode<K, T>* predecessor(K searchKey);
-
 		simpleBSTNode<K, T>* insertImpl(simpleBSTNode<K, T>* node, K key, T value);
 		simpleBSTNode<K, T>* removalImpl(simpleBSTNode<K, T>* node, K key);
 		simpleBSTNode<K, T>* deleteMin(simpleBSTNode<K, T>* node);
 		simpleBSTNode<K, T>* minImpl(simpleBSTNode<K, T>* node);
 		simpleBSTNode<K, T>* maxImpl(simpleBSTNode<K, T>* node);
 		simpleBSTNode<K, T>* searchImpl(K key, simpleBSTNode<K, T>* node) const;
-		simpleBSTNode<K, T>* successorImpl(K key, simpleBSTNode<K, T>* node, simpleBSTNode<K, T>* savedParent);
-		simpleBSTNode<K, T>* predecessorImpl(K key, simpleBSTNode<K, T>* node, simpleBSTNode<K, T>* savedParent);
+		bool iterateImpl(simpleBSTNode<K, T>* node, const simpleHashCallback<K, T>& callback) const;
+		bool rangeIterateImpl(simpleBSTNode<K, T>* node, const K& lowKey, const K& highKey, const simpleHashCallback<K, T>& callback) const;
 		simpleBSTNode<K, T>* balance(simpleBSTNode<K, T>* node);
+		void updateNode(simpleBSTNode<K, T>* node);
+		int sizeOf(simpleBSTNode<K, T>* node) const;
+		int countLessOrEqual(const K& searchKey) const;
 		simpleBSTNode<K, T>* rotateLeft(simpleBSTNode<K, T>* subTree);
 		simpleBSTNode<K, T>* rotateRight(simpleBSTNode<K, T>* node);
 
 		void clearImpl(simpleBSTNode<K, T>* node);
+		simpleBSTNode<K, T>* fromSortedImpl(const simpleArray<K>& sortedKeys, const simpleArray<T>& values, int lowIndex, int highIndex);
 
 	private:
 
@@ -141,6 +199,45 @@ namespace simple
 		_nodeMap->clear();
 	}
 
+	template<isHashable K, typename T>
+	void simpleBST<K, T>::fromSorted(const simpleArray<K>& sortedKeys, const simpleArray<T>& values)
+	{
+		if (sortedKeys.count() != values.count())
+			throw simpleException("Key and value arrays must be the same length:  simpleBST::fromSorted");
+
+		for (int index = 1; index < sortedKeys.count(); index++)
+		{
+			if (keyCompare(sortedKeys.get(index - 1), sortedKeys.get(index)) >= 0)
+				throw simpleException("Keys must be sorted, and unique:  simpleBST::fromSorted");
+		}
+
+		this->clear();
+
+		_root = this->fromSortedImpl(sortedKeys, values, 0, sortedKeys.count() - 1);
+	}
+
+	template<isHashable K, typename T>
+	simpleBSTNode<K, T>* simpleBST<K, T>::fromSortedImpl(const simpleArray<K>& sortedKeys, const simpleArray<T>& values, int lowIndex, int highIndex)
+	{
+		if (lowIndex > highIndex)
+			return nullptr;
+
+		// Middle key is the sub-tree root:  sub-tree sizes differ by at most one (balanced)
+		int middleIndex = lowIndex + (highIndex - lowIndex) / 2;
+
+		simpleBSTNode<K, T>* node = new simpleBSTNode<K, T>(sortedKeys.get(middleIndex), values.get(middleIndex));
+
+		node->setLeft(this->fromSortedImpl(sortedKeys, values, lowIndex, middleIndex - 1));
+		node->setRight(this->fromSortedImpl(sortedKeys, values, middleIndex + 1, highIndex));
+
+		// Set the height / size
+		this->updateNode(node);
+
+		_nodeMap->add(node->getKey(), node);
+
+		return node;
+	}
+
 	template<isHashable K, typename T>
 	void simpleBST<K, T>::insert(K key, T value)
 	{
@@ -166,12 +263,16 @@ namespace simple
 		// Remove the specified key -> Rebalance the tree
 		_root = this->removalImpl(_root, key);
 
-		// Item to return to user
-		T item = _nodeMap->get(key)->getValue();
+		// Item to return to user (node has been detached from the tree)
+		simpleBSTNode<K, T>* node = _nodeMap->get(key);
+		T item = node->getValue();
 
 		// Track the values for debugging and fast retrieval using the key
 		_nodeMap->remove(key);
 
+		// (MEMORY!)
+		delete node;
+
 		return item;
 	}
 
@@ -190,10 +291,55 @@ namespace simple
 	template<isHashable K, typename T>
 	void simpleBST<K, T>::iterate(simpleHashCallback<K, T> callback) const
 	{
-		_nodeMap->iterate([&callback] (K key, simpleBSTNode<K, T>* node)
+		this->iterateImpl(_root, callback);
+	}
+
+	template<isHashable K, typename T>
+	void simpleBST<K, T>::rangeIterate(K lowKey, K highKey, simpleHashCallback<K, T> callback) const
+	{
+		this->rangeIterateImpl(_root, lowKey, highKey, callback);
+	}
+
+	template<isHashable K, typename T>
+	bool simpleBST<K, T>::iterateImpl(simpleBSTNode<K, T>* node, const simpleHashCallback<K, T>& callback) const
+	{
+		// In-Order:  Left -> Node -> Right (returns false to stop the iteration)
+		if (node == nullptr)
+			return true;
+
+		if (!this->iterateImpl(node->getLeft(), callback))
+			return false;
+
+		if (callback(node->getKey(), node->getValue()) == iterationCallback::breakAndReturn)
+			return false;
+
+		return this->iterateImpl(node->getRight(), callback);
+	}
+
+	template<isHashable K, typename T>
+	bool simpleBST<K, T>::rangeIterateImpl(simpleBSTNode<K, T>* node, const K& lowKey, const K& highKey, const simpleHashCallback<K, T>& callback) const
+	{
+		if (node == nullptr)
+			return true;
+
+		int lowComparison = keyCompare(lowKey, node->getKey());
+		int highComparison = keyCompare(highKey, node->getKey());
+
+		// Left sub-tree may contain keys in range
+		if (lowComparison < 0 && !this->rangeIterateImpl(node->getLeft(), lowKey, highKey, callback))
+			return false;
+
+		if (lowComparison <= 0 && highComparison >= 0)
 		{
-			return callback(key, node->getValue());
-		});
+			if (callback(node->getKey(), node->getValue()) == iterationCallback::breakAndReturn)
+				return false;
+		}
+
+		// Right sub-tree may contain keys in range
+		if (highComparison > 0)
+			return this->rangeIterateImpl(node->getRight(), lowKey, highKey, callback);
+
+		return true;
 	}
 
 	template<isHashable K, typename T>
@@ -223,21 +369,150 @@ namespace simple
 	}
 
 	template<isHashable K, typename T>
-	simpleBSTNode<K, T>* simpleBST<K, T>::successor(K searchKey)
+	const simpleBSTNode<K, T>* simpleBST<K, T>::lowerBound(K searchKey) const
 	{
-		if (!_nodeMap->contains(searchKey))
-			return nullptr;
+		simpleBSTNode<K, T>* node = _root;
+		simpleBSTNode<K, T>* result = nullptr;
+
+		// Save the last node with key >= search key; and continue left
+		while (node != nullptr)
+		{
+			if (keyCompare(node->getKey(), searchKey) >= 0)
+			{
+				result = node;
+				node = node->getLeft();
+			}
+			else
+				node = node->getRight();
+		}
 
-		return this->successorImpl(searchKey, _root, nullptr);
+		return result;
 	}
 
 	template<isHashable K, typename T>
-	simpleBSTNode<K, T>* simpleBST<K, T>::predecessor(K searchKey)
+	const simpleBSTNode<K, T>* simpleBST<K, T>::upperBound(K searchKey) const
 	{
-		if (!_nodeMap->contains(searchKey))
-			return nullptr;
+		simpleBSTNode<K, T>* node = _root;
+		simpleBSTNode<K, T>* result = nullptr;
+
+		// Save the last node with key > search key; and continue left
+		while (node != nullptr)
+		{
+			if (keyCompare(node->getKey(), searchKey) > 0)
+			{
+				result = node;
+				node = node->getLeft();
+			}
+			else
+				node = node->getRight();
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename T>
+	const simpleBSTNode<K, T>* simpleBST<K, T>::successor(K searchKey) const
+	{
+		return this->upperBound(searchKey);
+	}
+
+	template<isHashable K, typename T>
+	const simpleBSTNode<K, T>* simpleBST<K, T>::predecessor(K searchKey) const
+	{
+		simpleBSTNode<K, T>* node = _root;
+		simpleBSTNode<K, T>* result = nullptr;
+
+		// Save the last node with key < search key; and continue right
+		while (node != nullptr)
+		{
+			if (keyCompare(node->getKey(), searchKey) < 0)
+			{
+				result = node;
+				node = node->getRight();
+			}
+			else
+				node = node->getLeft();
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename T>
+	int simpleBST<K, T>::rank(K searchKey) const
+	{
+		simpleBSTNode<K, T>* node = _root;
+		int result = 0;
+
+		// Count the left sub-tree (+ node) each time the search goes right
+		while (node != nullptr)
+		{
+			if (keyCompare(node->getKey(), searchKey) < 0)
+			{
+				result += this->sizeOf(node->getLeft()) + 1;
+				node = node->getRight();
+			}
+			else
+				node = node->getLeft();
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename T>
+	int simpleBST<K, T>::countLessOrEqual(const K& searchKey) const
+	{
+		simpleBSTNode<K, T>* node = _root;
+		int result = 0;
+
+		while (node != nullptr)
+		{
+			if (keyCompare(node->getKey(), searchKey) <= 0)
+			{
+				result += this->sizeOf(node->getLeft()) + 1;
+				node = node->getRight();
+			}
+			else
+				node = node->getLeft();
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename T>
+	const simpleBSTNode<K, T>* simpleBST<K, T>::select(int index) const
+	{
+		if (index < 0 || index >= this->sizeOf(_root))
+			throw simpleException("Index is outside the bounds of the simpleBST:  simpleBST::select");
+
+		simpleBSTNode<K, T>* node = _root;
+
+		while (node != nullptr)
+		{
+			int leftSize = this->sizeOf(node->getLeft());
+
+			if (index < leftSize)
+				node = node->getLeft();
+
+			else if (index > leftSize)
+			{
+				index -= leftSize + 1;
+				node = node->getRight();
+			}
+
+			else
+				return node;
+		}
+
+		throw simpleException("Invalid sub-tree size:  simpleBST::select");
+	}
+
+	template<isHashable K, typename T>
+	int simpleBST<K, T>::countInRange(K lowKey, K highKey) const
+	{
+		if (keyCompare(lowKey, highKey) > 0)
+			return 0;
 
-		return this->predecessorImpl(searchKey, _root, nullptr);
+		return this->countLessOrEqual(highKey) - this->rank(lowKey);
 	}
 
 	template<isHashable K, typename T>
@@ -307,11 +582,8 @@ namespace simple
 		else
 			throw simpleException(createExceptionMessage("Duplicate key insertion BinarySearchTree"));
 
-		// Set the height
-		int height = simpleMath::maxOf((node->getLeft() != nullptr) ? node->getLeft()->getHeight() : -1,
-									   (node->getRight() != nullptr) ? node->getRight()->getHeight() : -1) + 1;
-
-		node->setHeight(height);
+		// Set the height / size
+		this->updateNode(node);
 
 		return this->balance(node);
 	}
@@ -350,11 +622,8 @@ namespace simple
 			}
 		}
 
-		// Set the height
-		int height = simpleMath::maxOf((node->getLeft() != nullptr) ? node->getLeft()->getHeight() : -1,
-					   				   (node->getRight() != nullptr) ? node->getRight()->getHeight() : -1) + 1;
-
-		node->setHeight(height);
+		// Set the height / size
+		this->updateNode(node);
 
 		return this->balance(node);
 	}
@@ -367,11 +636,8 @@ namespace simple
 
 		node->setLeft(this->deleteMin(node->getLeft()));
 
-		// Set the height
-		int height = simpleMath::maxOf((node->getLeft() != nullptr) ? node->getLeft()->getHeight() : -1,
-									   (node->getRight() != nullptr) ? node->getRight()->getHeight() : -1) + 1;
-
-		node->setHeight(height);
+		// Set the height / size
+		this->updateNode(node);
 
 		return this->balance(node);
 	}
@@ -418,78 +684,6 @@ namespace simple
 			return node;
 	}
 
-	template<isHashable K, typename T>
-	simpleBSTNode<K, T>* simpleBST<K, T>::successorImpl(K key, simpleBSTNode<K, T>* node, simpleBSTNode<K, T>* savedParent)
-	{
-		// Recursively look for the search key's node - keeping track of the last parent with a LEFT child. This 
-		// will be the successor if the final search node has no left child.
-		//
-		// At the final leaf node - continue looking for the MAX of it's RIGHT sub-tree
-		//
-
-		if (node == nullptr)
-			return nullptr;
-
-		int comparison = keyCompare(key, node.Key);
-
-		if (comparison < 0 && node->getLeft() != nullptr)
-		{
-			// Keep track of this last parent
-			savedParent = node;
-
-			return this->successorImpl(key, node->getLeft(), savedParent);
-		}
-
-		else if (comparison > 0 && node->getRight() != nullptr)
-			return this->successorImpl(key, node->getRight(), savedParent);
-
-		// FOUND NODE!
-		else
-		{
-			if (node->getRight() != nullptr)
-				return this->minImpl(node->getRight());
-
-			else
-				return savedParent;
-		}
-	}
-
-	template<isHashable K, typename T>
-	simpleBSTNode<K, T>* simpleBST<K, T>::predecessorImpl(K key, simpleBSTNode<K, T>* node, simpleBSTNode<K, T>* savedParent)
-	{
-		// Recursively look for the search key's node - keeping track of the last parent with a RIGHT child. This 
-		// will be the predecessor if the final search node has no right child.
-		//
-		// At the final leaf node - continue looking for the MIN of it's LEFT sub-tree
-		//
-
-		if (node == nullptr)
-			return nullptr;
-
-		int comparison = keyCompare(key, node->getKey());
-
-		if (comparison < 0 && node->getLeft() != nullptr)
-			return this->predecessorImpl(key, node->getLeft(), savedParent);
-
-		else if (comparison > 0 && node->getRight() != nullptr)
-		{
-			// Keep track of this last parent
-			savedParent = node;
-
-			return PredecessorImpl(key, node->getRight(), savedParent);
-		}
-
-		// FOUND NODE!
-		else
-		{
-			if (node->getLeft() != nullptr)
-				return this->maxImpl(node->getLeft());
-
-			else
-				return savedParent;
-		}
-	}
-
 	template<isHashable K, typename T>
 	simpleBSTNode<K, T>* simpleBST<K, T>::balance(simpleBSTNode<K, T>* node)
 	{
@@ -528,6 +722,22 @@ namespace simple
 		return node;
 	}
 
+	template<isHashable K, typename T>
+	void simpleBST<K, T>::updateNode(simpleBSTNode<K, T>* node)
+	{
+		int height = simpleMath::maxOf((node->getLeft() != nullptr) ? node->getLeft()->getHeight() : -1,
+									   (node->getRight() != nullptr) ? node->getRight()->getHeight() : -1) + 1;
+
+		node->setHeight(height);
+		node->setSize(this->sizeOf(node->getLeft()) + this->sizeOf(node->getRight()) + 1);
+	}
+
+	template<isHashable K, typename T>
+	int simpleBST<K, T>::sizeOf(simpleBSTNode<K, T>* node) const
+	{
+		return (node == nullptr) ? 0 : node->getSize();
+	}
+
 	template<isHashable K, typename T>
 	simpleBSTNode<K, T>* simpleBST<K, T>::rotateLeft(simpleBSTNode<K, T>* subTree)
 	{
@@ -555,9 +765,9 @@ namespace simple
 		// Node's parent becomes the left child of node:  X <- Z
 		Z->setLeft(X);
 
-		// Set up height of nodes
-		X->setHeight(simpleMath::maxOf((X->getLeft() != nullptr) ? X->getLeft()->getHeight() : -1, (X->getRight() != nullptr) ? X->getRight()->getHeight() : -1) + 1);
-		Z->setHeight(simpleMath::maxOf((Z->getLeft() != nullptr) ? Z->getLeft()->getHeight() : -1, (Z->getRight() != nullptr) ? Z->getRight()->getHeight() : -1) + 1);
+		// Set up height / size of nodes (child first)
+		this->updateNode(X);
+		this->updateNode(Z);
 
 		// Return node of the new sub-tree
 		return Z;
@@ -590,9 +800,9 @@ namespace simple
 		// Node's parent becomes the right child of node:  Z -> X
 		Z->setRight(X);
 
-		// Set up height of nodes
-		X->setHeight(simpleMath::maxOf((X->getLeft() != nullptr) ? X->getLeft()->getHeight() : -1, (X->getRight() != nullptr) ? X->getRight()->getHeight() : -1) + 1);
-		Z->setHeight(simpleMath::maxOf((Z->getLeft() != nullptr) ? Z->getLeft()->getHeight() : -1, (Z->getRight() != nullptr) ? Z->getRight()->getHeight() : -1) + 1);
+		// Set up height / size of nodes (child first)
+		this->updateNode(X);
+		this->updateNode(Z);
 
 		// Return node of the new sub-tree
 		return Z;
@@ -639,7 +849,7 @@ namespace simple
 	template<isHashable K, typename T>
 	void simpleBST<K, T>::createOutputRecurse(simpleBSTNode<K,T>* node, int level, simpleString& result)
 	{
-		const char* messageFormat = "Node level {}: Key={} Value={} Height={} MAPPED={}";
+		constexpr const char* messageFormat = "Node level {}: Key={} Value={} Height={} MAPPED={}";
 		bool nodeFound = _nodeMap->contains(node->getKey());
 		std::string message = simpleExt::format(messageFormat, level, node->getKey(), node->getValue(), node->getHeight(), (int)nodeFound);
 
@@ -10,7 +10,7 @@ namespace simple
 	public:
 
 		/// <summary>
-		/// Creates an instance of the new BST node. The left, right, and height data
+		/// Creates an instance of the new BST node. The left, right, height, and size data
 		/// must be set by the BST tree implementation.
 		/// </summary>
 		simpleBSTNode(const K& key, const T& value)
@@ -20,6 +20,7 @@ namespace simple
 			_left = nullptr;
 			_right = nullptr;
 			_height = 0;
+			_size = 1;
 		}
 		simpleBSTNode(const simpleBSTNode& copy)
 		{
@@ -60,6 +61,14 @@ namespace simple
 		{
 			return _height;
 		}
+
+		/// <summary>
+		/// Number of nodes in this sub-tree (including this node)
+		/// </summary>
+		int getSize() const
+		{
+			return _size;
+		}
 		simpleBSTNode<K, T>* getLeft() const
 		{
 			return _left;
@@ -81,6 +90,10 @@ namespace simple
 		{
 			_height = height;
 		}
+		void setSize(int size)
+		{
+			_size = size;
+		}
 
 	public:
 
@@ -96,6 +109,7 @@ namespace simple
 			_left = copy.getLeft();
 			_right = copy.getRight();
 			_height = copy.getHeight();
+			_size = copy.getSize();
 			_key = copy.getKey();
 			_value = copy.getValue();
 		}
@@ -106,7 +120,8 @@ namespace simple
 				_value == other.getValue() &&
 				_left == other.getLeft() &&
 				_right == other.getRight() &&
-				_height == other.getHeight();
+				_height == other.getHeight() &&
+				_size == other.getSize();
 		}
 
 	private:
@@ -117,6 +132,7 @@ namespace simple
 		T _value;
 
 		int _height;
+		int _size;
 
 	};
 }
\ No newline at end of file
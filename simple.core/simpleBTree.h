@@ -0,0 +1,879 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleHashCore.h"
+
+namespace simple
+{
+	// B+ Tree Implementation - https://en.wikipedia.org/wiki/B%2B_tree
+	//
+	// - O(log n) Insert, Delete, Search
+	// - Wide nodes:  keys (and values) are stored contiguously in each node; so a search touches
+	//                a few cache lines per level (instead of one allocation per key as with simpleBST)
+	// - Entries are stored only in the leaves; and the leaves are linked for ordered (range) scans
+	// - Internal separator keys are the first key of their right sub-tree (may go stale after removal;
+	//   which is fine - they are still valid bounds)
+	//
+
+	/// <summary>
+	/// Ordered map (B+ tree) with contiguous node storage. Supports ordered iteration, range scans,
+	/// successor / predecessor queries, and min / max keys.
+	/// </summary>
+	/// <typeparam name="K">Key type (must support operator&lt; and operator==)</typeparam>
+	/// <typeparam name="V">Value type</typeparam>
+	template<isHashable K, typename V>
+	class simpleBTree
+	{
+	public:
+
+		/// <summary>
+		/// Maximum number of keys per node (~256 bytes of keys)
+		/// </summary>
+		static constexpr int NodeCapacity = (sizeof(K) >= 32) ? 8 : (int)(256 / sizeof(K));
+
+	public:
+
+		simpleBTree();
+		simpleBTree(const simpleBTree<K, V>& copy);
+		~simpleBTree();
+
+		void operator=(const simpleBTree<K, V>& copy);
+
+		void insert(const K& key, const V& value);
+		V remove(const K& key);
+		bool containsKey(const K& key) const;
+		int count() const;
+
+		V get(const K& key) const;
+		void set(const K& key, const V& value);
+
+		K minKey() const;
+		K maxKey() const;
+		V minValue() const;
+		V maxValue() const;
+
+		/// <summary>
+		/// Returns the smallest key that is greater than the search key (the search key need not be
+		/// in the tree). Throws an exception if there is none.
+		/// </summary>
+		K successor(const K& searchKey) const;
+
+		/// <summary>
+		/// Returns the largest key that is less than the search key (the search key need not be
+		/// in the tree). Throws an exception if there is none.
+		/// </summary>
+		K predecessor(const K& searchKey) const;
+
+		bool trySuccessor(const K& searchKey, K& result) const;
+		bool tryPredecessor(const K& searchKey, K& result) const;
+
+		void clear();
+
+	public:
+
+		/// <summary>
+		/// Iterates all entries in key order
+		/// </summary>
+		void iterate(const simpleHashCallback<K, V>& callback) const;
+
+		/// <summary>
+		/// Iterates entries with lowKey &lt;= key &lt;= highKey, in key order
+		/// </summary>
+		void rangeIterate(const K& lowKey, const K& highKey, const simpleHashCallback<K, V>& callback) const;
+
+	private:
+
+		static constexpr int MinKeys = NodeCapacity / 2;
+
+		struct node
+		{
+			bool isLeaf;
+			int count;
+
+			// One extra slot allows insert-then-split
+			K keys[NodeCapacity + 1];
+		};
+
+		struct leafNode : node
+		{
+			V values[NodeCapacity + 1];
+
+			leafNode* next;
+			leafNode* previous;
+		};
+
+		struct internalNode : node
+		{
+			node* children[NodeCapacity + 2];
+		};
+
+	private:
+
+		static int lowerBound(const node* aNode, const K& key);
+		static int upperBound(const node* aNode, const K& key);
+
+		leafNode* createLeaf() const;
+		internalNode* createInternal() const;
+
+		leafNode* findLeaf(const K& key) const;
+		leafNode* minLeaf() const;
+		leafNode* maxLeaf() const;
+
+		bool insertImpl(node* aNode, const K& key, const V& value, K& splitKey, node*& splitNode);
+		bool removeImpl(node* aNode, const K& key, V& removedValue);
+		void rebalanceChild(internalNode* parent, int childIndex);
+		void mergeChildren(internalNode* parent, int leftIndex);
+
+		void clearImpl(node* aNode);
+
+	private:
+
+		// Root of the tree (nullptr when empty)
+		node* _root;
+
+		int _count;
+	};
+
+	template<isHashable K, typename V>
+	simpleBTree<K, V>::simpleBTree()
+	{
+		_root = nullptr;
+		_count = 0;
+	}
+
+	template<isHashable K, typename V>
+	simpleBTree<K, V>::simpleBTree(const simpleBTree<K, V>& copy)
+		: simpleBTree()
+	{
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			this->insert(key, value);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable K, typename V>
+	simpleBTree<K, V>::~simpleBTree()
+	{
+		this->clear();
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::operator=(const simpleBTree<K, V>& copy)
+	{
+		if (this == &copy)
+			return;
+
+		this->clear();
+
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			this->insert(key, value);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::clear()
+	{
+		clearImpl(_root);
+
+		_root = nullptr;
+		_count = 0;
+	}
+
+	template<isHashable K, typename V>
+	int simpleBTree<K, V>::count() const
+	{
+		return _count;
+	}
+
+	template<isHashable K, typename V>
+	int simpleBTree<K, V>::lowerBound(const node* aNode, const K& key)
+	{
+		// First index with keys[index] >= key
+		int low = 0;
+		int high = aNode->count;
+
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+
+			if (aNode->keys[middle] < key)
+				low = middle + 1;
+			else
+				high = middle;
+		}
+
+		return low;
+	}
+
+	template<isHashable K, typename V>
+	int simpleBTree<K, V>::upperBound(const node* aNode, const K& key)
+	{
+		// First index with keys[index] > key
+		int low = 0;
+		int high = aNode->count;
+
+		while (low < high)
+		{
+			int middle = (low + high) / 2;
+
+			if (key < aNode->keys[middle])
+				high = middle;
+			else
+				low = middle + 1;
+		}
+
+		return low;
+	}
+
+	template<isHashable K, typename V>
+	typename simpleBTree<K, V>::leafNode* simpleBTree<K, V>::createLeaf() const
+	{
+		// (MEMORY!)
+		leafNode* result = new leafNode();
+
+		result->isLeaf = true;
+		result->count = 0;
+		result->next = nullptr;
+		result->previous = nullptr;
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	typename simpleBTree<K, V>::internalNode* simpleBTree<K, V>::createInternal() const
+	{
+		// (MEMORY!)
+		internalNode* result = new internalNode();
+
+		result->isLeaf = false;
+		result->count = 0;
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	typename simpleBTree<K, V>::leafNode* simpleBTree<K, V>::findLeaf(const K& key) const
+	{
+		node* current = _root;
+
+		if (current == nullptr)
+			return nullptr;
+
+		// Separator keys[i] is the lower bound of children[i + 1]
+		while (!current->isLeaf)
+		{
+			internalNode* internal = static_cast<internalNode*>(current);
+
+			current = internal->children[upperBound(internal, key)];
+		}
+
+		return static_cast<leafNode*>(current);
+	}
+
+	template<isHashable K, typename V>
+	typename simpleBTree<K, V>::leafNode* simpleBTree<K, V>::minLeaf() const
+	{
+		node* current = _root;
+
+		if (current == nullptr)
+			return nullptr;
+
+		while (!current->isLeaf)
+			current = static_cast<internalNode*>(current)->children[0];
+
+		return static_cast<leafNode*>(current);
+	}
+
+	template<isHashable K, typename V>
+	typename simpleBTree<K, V>::leafNode* simpleBTree<K, V>::maxLeaf() const
+	{
+		node* current = _root;
+
+		if (current == nullptr)
+			return nullptr;
+
+		while (!current->isLeaf)
+			current = static_cast<internalNode*>(current)->children[current->count];
+
+		return static_cast<leafNode*>(current);
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::insert(const K& key, const V& value)
+	{
+		if (_root == nullptr)
+			_root = createLeaf();
+
+		K splitKey = default_value::value<K>();
+		node* splitNode = nullptr;
+
+		// Root was split:  Tree grows by one level
+		if (insertImpl(_root, key, value, splitKey, splitNode))
+		{
+			internalNode* newRoot = createInternal();
+
+			newRoot->keys[0] = splitKey;
+			newRoot->children[0] = _root;
+			newRoot->children[1] = splitNode;
+			newRoot->count = 1;
+
+			_root = newRoot;
+		}
+
+		_count++;
+	}
+
+	template<isHashable K, typename V>
+	bool simpleBTree<K, V>::insertImpl(node* aNode, const K& key, const V& value, K& splitKey, node*& splitNode)
+	{
+		if (aNode->isLeaf)
+		{
+			leafNode* leaf = static_cast<leafNode*>(aNode);
+
+			int insertIndex = lowerBound(leaf, key);
+
+			if (insertIndex < leaf->count && leaf->keys[insertIndex] == key)
+				throw simpleException("Trying to insert a duplicate key in simpleBTree:  simpleBTree::insert");
+
+			// Shift right (uses the extra slot when full)
+			for (int index = leaf->count; index > insertIndex; index--)
+			{
+				leaf->keys[index] = leaf->keys[index - 1];
+				leaf->values[index] = leaf->values[index - 1];
+			}
+
+			leaf->keys[insertIndex] = key;
+			leaf->values[insertIndex] = value;
+			leaf->count++;
+
+			if (leaf->count <= NodeCapacity)
+				return false;
+
+			// Split:  Right half moves to a new leaf; first right key is copied up
+			leafNode* right = createLeaf();
+			int leftCount = leaf->count / 2;
+
+			for (int index = leftCount; index < leaf->count; index++)
+			{
+				right->keys[index - leftCount] = leaf->keys[index];
+				right->values[index - leftCount] = leaf->values[index];
+			}
+
+			right->count = leaf->count - leftCount;
+			leaf->count = leftCount;
+
+			// Link the leaf chain
+			right->next = leaf->next;
+			right->previous = leaf;
+
+			if (leaf->next != nullptr)
+				leaf->next->previous = right;
+
+			leaf->next = right;
+
+			splitKey = right->keys[0];
+			splitNode = right;
+
+			return true;
+		}
+		else
+		{
+			internalNode* internal = static_cast<internalNode*>(aNode);
+
+			int childIndex = upperBound(internal, key);
+
+			K childSplitKey = default_value::value<K>();
+			node* childSplitNode = nullptr;
+
+			if (!insertImpl(internal->children[childIndex], key, value, childSplitKey, childSplitNode))
+				return false;
+
+			// Child was split:  Insert the separator + new child
+			for (int index = internal->count; index > childIndex; index--)
+			{
+				internal->keys[index] = internal->keys[index - 1];
+				internal->children[index + 1] = internal->children[index];
+			}
+
+			internal->keys[childIndex] = childSplitKey;
+			internal->children[childIndex + 1] = childSplitNode;
+			internal->count++;
+
+			if (internal->count <= NodeCapacity)
+				return false;
+
+			// Split:  Middle key moves up
+			internalNode* right = createInternal();
+			int middle = internal->count / 2;
+
+			for (int index = middle + 1; index < internal->count; index++)
+				right->keys[index - middle - 1] = internal->keys[index];
+
+			for (int index = middle + 1; index <= internal->count; index++)
+				right->children[index - middle - 1] = internal->children[index];
+
+			right->count = internal->count - middle - 1;
+
+			splitKey = internal->keys[middle];
+			splitNode = right;
+
+			internal->count = middle;
+
+			return true;
+		}
+	}
+
+	template<isHashable K, typename V>
+	V simpleBTree<K, V>::remove(const K& key)
+	{
+		V result = default_value::value<V>();
+
+		if (_root == nullptr || !removeImpl(_root, key, result))
+			throw simpleException("Trying to remove non-existing key from simpleBTree:  simpleBTree::remove");
+
+		_count--;
+
+		// Root Collapse:  Tree shrinks by one level
+		if (!_root->isLeaf && _root->count == 0)
+		{
+			node* oldRoot = _root;
+
+			_root = static_cast<internalNode*>(oldRoot)->children[0];
+
+			delete static_cast<internalNode*>(oldRoot);
+		}
+
+		// Empty Tree
+		else if (_root->isLeaf && _root->count == 0)
+		{
+			delete static_cast<leafNode*>(_root);
+
+			_root = nullptr;
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	bool simpleBTree<K, V>::removeImpl(node* aNode, const K& key, V& removedValue)
+	{
+		if (aNode->isLeaf)
+		{
+			leafNode* leaf = static_cast<leafNode*>(aNode);
+
+			int removeIndex = lowerBound(leaf, key);
+
+			if (removeIndex >= leaf->count || !(leaf->keys[removeIndex] == key))
+				return false;
+
+			removedValue = leaf->values[removeIndex];
+
+			for (int index = removeIndex; index < leaf->count - 1; index++)
+			{
+				leaf->keys[index] = leaf->keys[index + 1];
+				leaf->values[index] = leaf->values[index + 1];
+			}
+
+			leaf->count--;
+
+			return true;
+		}
+		else
+		{
+			internalNode* internal = static_cast<internalNode*>(aNode);
+
+			int childIndex = upperBound(internal, key);
+
+			if (!removeImpl(internal->children[childIndex], key, removedValue))
+				return false;
+
+			if (internal->children[childIndex]->count < MinKeys)
+				rebalanceChild(internal, childIndex);
+
+			return true;
+		}
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::rebalanceChild(internalNode* parent, int childIndex)
+	{
+		node* child = parent->children[childIndex];
+		node* left = (childIndex > 0) ? parent->children[childIndex - 1] : nullptr;
+		node* right = (childIndex < parent->count) ? parent->children[childIndex + 1] : nullptr;
+
+		// Borrow from the left sibling
+		if (left != nullptr && left->count > MinKeys)
+		{
+			if (child->isLeaf)
+			{
+				leafNode* leaf = static_cast<leafNode*>(child);
+				leafNode* leftLeaf = static_cast<leafNode*>(left);
+
+				for (int index = leaf->count; index > 0; index--)
+				{
+					leaf->keys[index] = leaf->keys[index - 1];
+					leaf->values[index] = leaf->values[index - 1];
+				}
+
+				leaf->keys[0] = leftLeaf->keys[leftLeaf->count - 1];
+				leaf->values[0] = leftLeaf->values[leftLeaf->count - 1];
+				leaf->count++;
+				leftLeaf->count--;
+
+				parent->keys[childIndex - 1] = leaf->keys[0];
+			}
+			else
+			{
+				internalNode* internal = static_cast<internalNode*>(child);
+				internalNode* leftInternal = static_cast<internalNode*>(left);
+
+				for (int index = internal->count; index > 0; index--)
+					internal->keys[index] = internal->keys[index - 1];
+
+				for (int index = internal->count + 1; index > 0; index--)
+					internal->children[index] = internal->children[index - 1];
+
+				// Separator rotates down; left's last key rotates up
+				internal->keys[0] = parent->keys[childIndex - 1];
+				internal->children[0] = leftInternal->children[leftInternal->count];
+				internal->count++;
+
+				parent->keys[childIndex - 1] = leftInternal->keys[leftInternal->count - 1];
+				leftInternal->count--;
+			}
+		}
+
+		// Borrow from the right sibling
+		else if (right != nullptr && right->count > MinKeys)
+		{
+			if (child->isLeaf)
+			{
+				leafNode* leaf = static_cast<leafNode*>(child);
+				leafNode* rightLeaf = static_cast<leafNode*>(right);
+
+				leaf->keys[leaf->count] = rightLeaf->keys[0];
+				leaf->values[leaf->count] = rightLeaf->values[0];
+				leaf->count++;
+
+				for (int index = 0; index < rightLeaf->count - 1; index++)
+				{
+					rightLeaf->keys[index] = rightLeaf->keys[index + 1];
+					rightLeaf->values[index] = rightLeaf->values[index + 1];
+				}
+
+				rightLeaf->count--;
+
+				parent->keys[childIndex] = rightLeaf->keys[0];
+			}
+			else
+			{
+				internalNode* internal = static_cast<internalNode*>(child);
+				internalNode* rightInternal = static_cast<internalNode*>(right);
+
+				// Separator rotates down; right's first key rotates up
+				internal->keys[internal->count] = parent->keys[childIndex];
+				internal->children[internal->count + 1] = rightInternal->children[0];
+				internal->count++;
+
+				parent->keys[childIndex] = rightInternal->keys[0];
+
+				for (int index = 0; index < rightInternal->count - 1; index++)
+					rightInternal->keys[index] = rightInternal->keys[index + 1];
+
+				for (int index = 0; index < rightInternal->count; index++)
+					rightInternal->children[index] = rightInternal->children[index + 1];
+
+				rightInternal->count--;
+			}
+		}
+
+		// Merge with a sibling
+		else if (left != nullptr)
+			mergeChildren(parent, childIndex - 1);
+
+		else if (right != nullptr)
+			mergeChildren(parent, childIndex);
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::mergeChildren(internalNode* parent, int leftIndex)
+	{
+		node* left = parent->children[leftIndex];
+		node* right = parent->children[leftIndex + 1];
+
+		if (left->isLeaf)
+		{
+			leafNode* leftLeaf = static_cast<leafNode*>(left);
+			leafNode* rightLeaf = static_cast<leafNode*>(right);
+
+			for (int index = 0; index < rightLeaf->count; index++)
+			{
+				leftLeaf->keys[leftLeaf->count + index] = rightLeaf->keys[index];
+				leftLeaf->values[leftLeaf->count + index] = rightLeaf->values[index];
+			}
+
+			leftLeaf->count += rightLeaf->count;
+
+			// Unlink the right leaf
+			leftLeaf->next = rightLeaf->next;
+
+			if (rightLeaf->next != nullptr)
+				rightLeaf->next->previous = leftLeaf;
+
+			delete rightLeaf;
+		}
+		else
+		{
+			internalNode* leftInternal = static_cast<internalNode*>(left);
+			internalNode* rightInternal = static_cast<internalNode*>(right);
+
+			// Separator comes down between the two key sets
+			leftInternal->keys[leftInternal->count] = parent->keys[leftIndex];
+
+			for (int index = 0; index < rightInternal->count; index++)
+				leftInternal->keys[leftInternal->count + 1 + index] = rightInternal->keys[index];
+
+			for (int index = 0; index <= rightInternal->count; index++)
+				leftInternal->children[leftInternal->count + 1 + index] = rightInternal->children[index];
+
+			leftInternal->count += rightInternal->count + 1;
+
+			delete rightInternal;
+		}
+
+		// Remove the separator + right child from the parent
+		for (int index = leftIndex; index < parent->count - 1; index++)
+		{
+			parent->keys[index] = parent->keys[index + 1];
+			parent->children[index + 1] = parent->children[index + 2];
+		}
+
+		parent->count--;
+	}
+
+	template<isHashable K, typename V>
+	bool simpleBTree<K, V>::containsKey(const K& key) const
+	{
+		leafNode* leaf = findLeaf(key);
+
+		if (leaf == nullptr)
+			return false;
+
+		int index = lowerBound(leaf, key);
+
+		return index < leaf->count && leaf->keys[index] == key;
+	}
+
+	template<isHashable K, typename V>
+	V simpleBTree<K, V>::get(const K& key) const
+	{
+		leafNode* leaf = findLeaf(key);
+
+		if (leaf != nullptr)
+		{
+			int index = lowerBound(leaf, key);
+
+			if (index < leaf->count && leaf->keys[index] == key)
+				return leaf->values[index];
+		}
+
+		throw simpleException("Key not found in simpleBTree:  simpleBTree::get");
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::set(const K& key, const V& value)
+	{
+		leafNode* leaf = findLeaf(key);
+
+		if (leaf != nullptr)
+		{
+			int index = lowerBound(leaf, key);
+
+			if (index < leaf->count && leaf->keys[index] == key)
+			{
+				leaf->values[index] = value;
+				return;
+			}
+		}
+
+		throw simpleException("Key not found in simpleBTree:  simpleBTree::set");
+	}
+
+	template<isHashable K, typename V>
+	K simpleBTree<K, V>::minKey() const
+	{
+		if (_root == nullptr)
+			throw simpleException("Trying to resolve min key from an empty simpleBTree");
+
+		return minLeaf()->keys[0];
+	}
+
+	template<isHashable K, typename V>
+	K simpleBTree<K, V>::maxKey() const
+	{
+		if (_root == nullptr)
+			throw simpleException("Trying to resolve max key from an empty simpleBTree");
+
+		leafNode* leaf = maxLeaf();
+
+		return leaf->keys[leaf->count - 1];
+	}
+
+	template<isHashable K, typename V>
+	V simpleBTree<K, V>::minValue() const
+	{
+		if (_root == nullptr)
+			throw simpleException("Trying to resolve min value from an empty simpleBTree");
+
+		return minLeaf()->values[0];
+	}
+
+	template<isHashable K, typename V>
+	V simpleBTree<K, V>::maxValue() const
+	{
+		if (_root == nullptr)
+			throw simpleException("Trying to resolve max value from an empty simpleBTree");
+
+		leafNode* leaf = maxLeaf();
+
+		return leaf->values[leaf->count - 1];
+	}
+
+	template<isHashable K, typename V>
+	bool simpleBTree<K, V>::trySuccessor(const K& searchKey, K& result) const
+	{
+		leafNode* leaf = findLeaf(searchKey);
+
+		if (leaf == nullptr)
+			return false;
+
+		int index = upperBound(leaf, searchKey);
+
+		if (index < leaf->count)
+		{
+			result = leaf->keys[index];
+			return true;
+		}
+
+		// First key of the next leaf
+		if (leaf->next != nullptr)
+		{
+			result = leaf->next->keys[0];
+			return true;
+		}
+
+		return false;
+	}
+
+	template<isHashable K, typename V>
+	bool simpleBTree<K, V>::tryPredecessor(const K& searchKey, K& result) const
+	{
+		leafNode* leaf = findLeaf(searchKey);
+
+		if (leaf == nullptr)
+			return false;
+
+		int index = lowerBound(leaf, searchKey);
+
+		if (index > 0)
+		{
+			result = leaf->keys[index - 1];
+			return true;
+		}
+
+		// Last key of the previous leaf
+		if (leaf->previous != nullptr)
+		{
+			result = leaf->previous->keys[leaf->previous->count - 1];
+			return true;
+		}
+
+		return false;
+	}
+
+	template<isHashable K, typename V>
+	K simpleBTree<K, V>::successor(const K& searchKey) const
+	{
+		K result = default_value::value<K>();
+
+		if (!trySuccessor(searchKey, result))
+			throw simpleException("No successor found for key:  simpleBTree::successor");
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	K simpleBTree<K, V>::predecessor(const K& searchKey) const
+	{
+		K result = default_value::value<K>();
+
+		if (!tryPredecessor(searchKey, result))
+			throw simpleException("No predecessor found for key:  simpleBTree::predecessor");
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	{
+		for (leafNode* leaf = minLeaf(); leaf != nullptr; leaf = leaf->next)
+		{
+			for (int index = 0; index < leaf->count; index++)
+			{
+				if (callback(leaf->keys[index], leaf->values[index]) == iterationCallback::breakAndReturn)
+					return;
+			}
+		}
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::rangeIterate(const K& lowKey, const K& highKey, const simpleHashCallback<K, V>& callback) const
+	{
+		leafNode* leaf = findLeaf(lowKey);
+
+		if (leaf == nullptr)
+			return;
+
+		int index = lowerBound(leaf, lowKey);
+
+		// Walk the leaf chain until the high key is passed
+		while (leaf != nullptr)
+		{
+			for (; index < leaf->count; index++)
+			{
+				if (highKey < leaf->keys[index])
+					return;
+
+				if (callback(leaf->keys[index], leaf->values[index]) == iterationCallback::breakAndReturn)
+					return;
+			}
+
+			leaf = leaf->next;
+			index = 0;
+		}
+	}
+
+	template<isHashable K, typename V>
+	void simpleBTree<K, V>::clearImpl(node* aNode)
+	{
+		if (aNode == nullptr)
+			return;
+
+		if (aNode->isLeaf)
+		{
+			delete static_cast<leafNode*>(aNode);
+			return;
+		}
+
+		internalNode* internal = static_cast<internalNode*>(aNode);
+
+		for (int index = 0; index <= internal->count; index++)
+			clearImpl(internal->children[index]);
+
+		delete internal;
+	}
+}
@@ -7,15 +7,18 @@
 #include "simpleBuffer.h"
 #include "simpleException.h"
 #include "simpleExt.h"
+#include "simpleMappedFile.h"
 #include "simpleMaskedInt32.h"
 #include "simplePixel.h"
 #include "simplePixelFilter.h"
 #include "simpleString.h"
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <filesystem>
 #include <fstream>
 #include <iosfwd>
+#include <memory>
 
 namespace simple
 {
@@ -35,7 +38,8 @@ namespace simple
 					 BITMAPV5HEADER* dibHeader,
 					 BitmapOptionalMasks* optionalMasks,
 					 uint32_t resolvedWidth,
-					 uint32_t resolvedHeight);
+					 uint32_t resolvedHeight,
+					 char* fileData = nullptr);
 		simpleBitmap(const simpleBitmap& copy);
 		~simpleBitmap();
 
@@ -110,6 +114,9 @@ namespace simple
 		simpleBuffer* _fileBuffer;
 		simpleBuffer* _colorDataBuffer;
 
+		// (MEMORY!) File bytes under the file buffer (fromFile); or nullptr
+		std::unique_ptr<char[]> _fileData;
+
 		uint32_t _resolvedWidth;
 		uint32_t _resolvedHeight;
 
@@ -131,7 +138,8 @@ namespace simple
 							   BITMAPV5HEADER* dibHeader,
 							   BitmapOptionalMasks* optionalMasks,
 							   uint32_t resolvedWidth,
-							   uint32_t resolvedHeight)
+							   uint32_t resolvedHeight,
+							   char* fileData)
 	{
 		_fileBuffer = fileBuffer;
 		_colorDataBuffer = colorDataBuffer;
@@ -141,17 +149,32 @@ namespace simple
 		_optionalMasks = optionalMasks;
 		_resolvedWidth = resolvedWidth;
 		_resolvedHeight = resolvedHeight;
+		_fileData.reset(fileData);
 	}
 	simpleBitmap::simpleBitmap(const simpleBitmap& copy)
 	{
-		_signatureHeader = copy.getSignature();
-		_dibHeader = copy.getDIBHeader();
-		_coreHeader = copy.getCoreHeader();
-		_colorDataBuffer = copy.getColorDataBuffer();
-		_fileBuffer = copy.getBuffer();
+		// (MEMORY!) Deep copy of what the destructor deletes (headers, buffers, file bytes). The color
+		//			 data bytes are shared (the buffer does not own them).
+		_signatureHeader = (copy.getSignature() == nullptr) ? nullptr : new BitmapFileHeader(*copy.getSignature());
+		_dibHeader = (copy.getDIBHeader() == nullptr) ? nullptr : new BITMAPV5HEADER(*copy.getDIBHeader());
+		_coreHeader = (copy.getCoreHeader() == nullptr) ? nullptr : new BITMAPCOREHEADER(*copy.getCoreHeader());
+		_colorDataBuffer = (copy.getColorDataBuffer() == nullptr) ? nullptr : new simpleBuffer(*copy.getColorDataBuffer());
 		_optionalMasks = copy.getOptionalMasks();
 		_resolvedWidth = copy.pixelWidth();
 		_resolvedHeight = copy.pixelHeight();
+
+		if (copy._fileData != nullptr)
+		{
+			size_t fileSize = copy.getBuffer()->getBufferSize();
+
+			_fileData = std::make_unique<char[]>(fileSize);
+
+			std::memcpy(_fileData.get(), copy._fileData.get(), fileSize);
+
+			_fileBuffer = new simpleBuffer(_fileData.get(), fileSize, false);
+		}
+		else
+			_fileBuffer = (copy.getBuffer() == nullptr) ? nullptr : new simpleBuffer(*copy.getBuffer());
 	}
 	simpleBitmap::~simpleBitmap()
 	{
@@ -181,12 +204,17 @@ namespace simple
 			if (fileSize <= 0)
 				return nullptr;
 
-			fileBufferIn = new char[fileSize];
+			// (MEMORY!) Copy the file out of a (temporary) mapping:  The bitmap keeps its own bytes; so
+			//			 the file is not held open / mapped, and toFile may write over it.
+			{
+				simpleMappedFile mappedFile(filename, simpleMappedFileMode::ReadOnly);
 
-			std::ifstream stream(filename.c_str());
+				mappedFile.advise(simpleMappedFileAccess::Sequential);
 
-			stream.get(fileBufferIn, fileSize);
-			stream.close();
+				fileBufferIn = new char[fileSize];
+
+				std::memcpy(fileBufferIn, mappedFile.getData(), fileSize);
+			}
 
 			simpleBuffer* fileBuffer = new simpleBuffer(fileBufferIn, (int)fileSize, false);
 
@@ -254,10 +282,7 @@ namespace simple
 				//	throw simpleException("Invalid bitmap file decoding:  Image Data doesn't align with header values");
 
 				// Direct Buffer Copy
-				for (int index = signature->ImageDataOffset; index < fileSize; index++)
-				{
-					colorDataBufferIn[index - signature->ImageDataOffset] = fileBufferIn[index];
-				}
+				std::memcpy(colorDataBufferIn, fileBufferIn + signature->ImageDataOffset, colorDataBufferSize);
 			}
 			else
 				throw simpleException("Invalid bitmap file decoding:  Either corrupt file or improper use of DIB header");
@@ -297,12 +322,21 @@ namespace simple
 
 			simpleBuffer* colorDataBuffer = new simpleBuffer(colorDataBufferIn, colorDataBufferSize, true);
 
-			return new simpleBitmap(fileBuffer, colorDataBuffer, signature, coreHeader, dibHeader, nullptr, resolvedWidth, resolvedHeight);
+			return new simpleBitmap(fileBuffer, colorDataBuffer, signature, coreHeader, dibHeader, nullptr, resolvedWidth, resolvedHeight, fileBufferIn);
 		}
 		catch (std::exception& ex)
 		{
+			delete[] fileBufferIn;
+
 			throw simpleException(simpleExt::format("Error reading bitmap file : {}", ex.what()));
 		}
+		catch (...)
+		{
+			// (simpleException is not a std::exception)
+			delete[] fileBufferIn;
+
+			throw;
+		}
 	}
 	void simpleBitmap::toFile(const simpleString& filename)
 	{
@@ -331,10 +365,14 @@ namespace simple
 			//	outputBuffer.encode32(index * 4, colorData.get(index).getRGBA());
 			//}
 
-			std::ofstream stream(filename.c_str());
+			std::ofstream stream(filename.c_str(), std::ios::out | std::ios::binary);
 
 			stream.write(_fileBuffer->getBuffer(), _fileBuffer->getBufferSize());
 			stream.flush();
+
+			if (!stream.good())
+				throw simpleException(simpleExt::format("Error writing bitmap file:  {}", filename));
+
 			stream.close();
 
 			//delete [] buffer;
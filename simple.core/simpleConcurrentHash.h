@@ -0,0 +1,376 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleHash.h"
+#include "simpleHashCore.h"
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace simple
+{
+	/// <summary>
+	/// Value factory for simpleConcurrentHash::getOrAdd
+	/// </summary>
+	template<isHashable K, typename V>
+	using simpleConcurrentHashFactory = std::function<V(const K& key)>;
+
+	/// <summary>
+	/// Computes the new value for a key in simpleConcurrentHash::compute. The current value is
+	/// nullptr when the key is not in the table.
+	/// </summary>
+	template<isHashable K, typename V>
+	using simpleConcurrentHashCompute = std::function<V(const K& key, const V* currentValue)>;
+
+	/*
+		Concurrent Hash:  Lock striping over simpleHash tables
+
+		- Keys are split over StripeCount stripes (by key hash); and each stripe is a simpleHash with
+		  its own reader / writer lock. Readers of a stripe run concurrently; writers only block their
+		  own stripe.
+		- getOrAdd / compute hold the stripe's write lock for the whole read-modify-write; so they are
+		  atomic with respect to every other operation on the key. (The callbacks must not call back
+		  into the table)
+		- Iteration runs over a snapshot taken with all stripes read-locked (consistent point in time);
+		  so the callback may use the table.
+	*/
+	template<isHashable K, typename V>
+	class simpleConcurrentHash : public simpleObject
+	{
+	public:
+
+		/// <summary>
+		/// Number of independently locked stripes (power of two)
+		/// </summary>
+		static constexpr int StripeCount = 64;
+
+	public:
+
+		simpleConcurrentHash();
+		simpleConcurrentHash(const simpleConcurrentHash<K, V>& copy);
+		~simpleConcurrentHash();
+
+		void operator=(const simpleConcurrentHash<K, V>& copy);
+
+		V get(const K& key) const;
+		bool tryGet(const K& key, V& value) const;
+
+		void add(const K& key, const V& value);
+		bool tryAdd(const K& key, const V& value);
+		void set(const K& key, const V& value);
+
+		bool contains(const K& key) const;
+		bool remove(const K& key);
+
+		/// <summary>
+		/// Returns the value for the key; or adds the value from the factory (called at most once
+		/// per missing key)
+		/// </summary>
+		V getOrAdd(const K& key, const simpleConcurrentHashFactory<K, V>& factory);
+
+		/// <summary>
+		/// Sets (or adds) the value computed from the current value (atomic); and returns it
+		/// </summary>
+		V compute(const K& key, const simpleConcurrentHashCompute<K, V>& computer);
+
+		/// <summary>
+		/// Number of entries (each stripe is counted under its lock; may be stale under writes)
+		/// </summary>
+		int count() const;
+		void clear();
+
+		/// <summary>
+		/// Copy of the entries at one point in time
+		/// </summary>
+		simpleHash<K, V> snapshot() const;
+
+		/// <summary>
+		/// Iterates a snapshot of the entries
+		/// </summary>
+		void iterate(const simpleHashCallback<K, V>& callback) const;
+
+	public:
+
+		size_t getHash() const override;
+
+	private:
+
+		struct alignas(simpleCacheLineSize) stripe
+		{
+			mutable std::shared_mutex lock;
+			simpleHash<K, V> table;
+		};
+
+		stripe& getStripe(const K& key) const;
+
+		void copyImpl(const simpleConcurrentHash<K, V>& copy);
+
+	private:
+
+		// (MEMORY!) Stripes are not movable (mutex)
+		stripe* _stripes;
+	};
+
+	template<isHashable K, typename V>
+	simpleConcurrentHash<K, V>::simpleConcurrentHash()
+	{
+		_stripes = new stripe[StripeCount];
+	}
+
+	template<isHashable K, typename V>
+	simpleConcurrentHash<K, V>::simpleConcurrentHash(const simpleConcurrentHash<K, V>& copy)
+		: simpleConcurrentHash()
+	{
+		this->copyImpl(copy);
+	}
+
+	template<isHashable K, typename V>
+	simpleConcurrentHash<K, V>::~simpleConcurrentHash()
+	{
+		delete[] _stripes;
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::operator=(const simpleConcurrentHash<K, V>& copy)
+	{
+		if (this == &copy)
+			return;
+
+		this->copyImpl(copy);
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::copyImpl(const simpleConcurrentHash<K, V>& copy)
+	{
+		// Copy the source stripes first; then write them here. (Only one lock is held at a time:
+		// holding a source lock while waiting on a target lock deadlocks with a copy the other way
+		// around - a = b and b = a on two threads)
+		std::vector<simpleHash<K, V>> tables(StripeCount);
+
+		for (int index = 0; index < StripeCount; index++)
+		{
+			std::shared_lock<std::shared_mutex> readLock(copy._stripes[index].lock);
+
+			tables[index] = copy._stripes[index].table;
+		}
+
+		// Stripe i of the copy holds exactly the keys of stripe i here
+		for (int index = 0; index < StripeCount; index++)
+		{
+			std::unique_lock<std::shared_mutex> writeLock(_stripes[index].lock);
+
+			_stripes[index].table = tables[index];
+		}
+	}
+
+	template<isHashable K, typename V>
+	typename simpleConcurrentHash<K, V>::stripe& simpleConcurrentHash<K, V>::getStripe(const K& key) const
+	{
+		// Fibonacci hashing:  top bits of the (mixed) key hash
+		uint64_t hash = (uint64_t)hashGenerator::generateHash(key) * 0x9E3779B97F4A7C15ull;
+
+		return _stripes[hash >> (64 - std::countr_zero((unsigned int)StripeCount))];
+	}
+
+	template<isHashable K, typename V>
+	V simpleConcurrentHash<K, V>::get(const K& key) const
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::shared_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (!keyStripe.table.contains(key))
+			throw simpleException("Key not found in simpleConcurrentHash:  simpleConcurrentHash::get");
+
+		return keyStripe.table.get(key);
+	}
+
+	template<isHashable K, typename V>
+	bool simpleConcurrentHash<K, V>::tryGet(const K& key, V& value) const
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::shared_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (!keyStripe.table.contains(key))
+			return false;
+
+		value = keyStripe.table.get(key);
+
+		return true;
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::add(const K& key, const V& value)
+	{
+		if (!this->tryAdd(key, value))
+			throw simpleException("Trying to add duplicate key to simpleConcurrentHash:  simpleConcurrentHash::add");
+	}
+
+	template<isHashable K, typename V>
+	bool simpleConcurrentHash<K, V>::tryAdd(const K& key, const V& value)
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::unique_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (keyStripe.table.contains(key))
+			return false;
+
+		keyStripe.table.add(key, value);
+
+		return true;
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::set(const K& key, const V& value)
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::unique_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (!keyStripe.table.contains(key))
+			throw simpleException("Key not found in simpleConcurrentHash:  simpleConcurrentHash::set");
+
+		keyStripe.table.set(key, value);
+	}
+
+	template<isHashable K, typename V>
+	bool simpleConcurrentHash<K, V>::contains(const K& key) const
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::shared_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		return keyStripe.table.contains(key);
+	}
+
+	template<isHashable K, typename V>
+	bool simpleConcurrentHash<K, V>::remove(const K& key)
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::unique_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		return keyStripe.table.remove(key);
+	}
+
+	template<isHashable K, typename V>
+	V simpleConcurrentHash<K, V>::getOrAdd(const K& key, const simpleConcurrentHashFactory<K, V>& factory)
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		// Hit:  Read lock only
+		{
+			std::shared_lock<std::shared_mutex> lock(keyStripe.lock);
+
+			if (keyStripe.table.contains(key))
+				return keyStripe.table.get(key);
+		}
+
+		// Miss:  Check again under the write lock (another writer may have added it)
+		std::unique_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (keyStripe.table.contains(key))
+			return keyStripe.table.get(key);
+
+		V value = factory(key);
+
+		keyStripe.table.add(key, value);
+
+		return value;
+	}
+
+	template<isHashable K, typename V>
+	V simpleConcurrentHash<K, V>::compute(const K& key, const simpleConcurrentHashCompute<K, V>& computer)
+	{
+		stripe& keyStripe = this->getStripe(key);
+
+		std::unique_lock<std::shared_mutex> lock(keyStripe.lock);
+
+		if (keyStripe.table.contains(key))
+		{
+			V currentValue = keyStripe.table.get(key);
+			V value = computer(key, &currentValue);
+
+			keyStripe.table.set(key, value);
+
+			return value;
+		}
+		else
+		{
+			V value = computer(key, nullptr);
+
+			keyStripe.table.add(key, value);
+
+			return value;
+		}
+	}
+
+	template<isHashable K, typename V>
+	int simpleConcurrentHash<K, V>::count() const
+	{
+		int result = 0;
+
+		for (int index = 0; index < StripeCount; index++)
+		{
+			std::shared_lock<std::shared_mutex> lock(_stripes[index].lock);
+
+			result += _stripes[index].table.count();
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::clear()
+	{
+		for (int index = 0; index < StripeCount; index++)
+		{
+			std::unique_lock<std::shared_mutex> lock(_stripes[index].lock);
+
+			_stripes[index].table.clear();
+		}
+	}
+
+	template<isHashable K, typename V>
+	simpleHash<K, V> simpleConcurrentHash<K, V>::snapshot() const
+	{
+		simpleHash<K, V> result;
+
+		// Lock all stripes (in order - no lock cycles with other snapshots / copies)
+		std::shared_lock<std::shared_mutex> locks[StripeCount];
+
+		for (int index = 0; index < StripeCount; index++)
+			locks[index] = std::shared_lock<std::shared_mutex>(_stripes[index].lock);
+
+		for (int index = 0; index < StripeCount; index++)
+		{
+			_stripes[index].table.iterate([&result] (const K& key, const V& value)
+			{
+				result.add(key, value);
+				return iterationCallback::iterate;
+			});
+		}
+
+		return result;
+	}
+
+	template<isHashable K, typename V>
+	void simpleConcurrentHash<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	{
+		simpleHash<K, V> entries = this->snapshot();
+
+		entries.iterate(callback);
+	}
+
+	template<isHashable K, typename V>
+	size_t simpleConcurrentHash<K, V>::getHash() const
+	{
+		return this->snapshot().getHash();
+	}
+}
@@ -32,8 +32,8 @@ namespace simple
 			{
 				const std::stacktrace_entry stack = std::stacktrace::current().at(index);
 
-				const char* format1 = "Source File:  {}  Line:  {}  \r\n";
-				const char* format2 = "Description:  {} \r\n";
+				constexpr const char* format1 = "Source File:  {}  Line:  {}  \r\n";
+				constexpr const char* format2 = "Description:  {} \r\n";
 
 				result += simpleExt::format(format1, stack.source_file().c_str(), stack.source_line());
 				result += simpleExt::format(format2, stack.description().c_str());
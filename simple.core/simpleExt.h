@@ -1,7 +1,9 @@
 #pragma once
 
 #include "simple.h"
+#include "simpleFormat.h"
 
+#include <charconv>
 #include <corecrt.h>
 #include <ctime>
 #include <stdexcept>
@@ -57,74 +59,20 @@ namespace simple
 
 	public:
 
-		template<isStringConvertible T>
-		static std::string format(const char* formatStr, const T& param)
+		/// <summary>
+		/// Formats the arguments into a new std::string (see simpleFormat:  the format string is parsed
+		/// at compile time; and supports width / precision / hex specs)
+		/// </summary>
+		template<isStringConvertible...Args>
+		static std::string format(simpleFormatString<std::type_identity_t<Args>...> formatStr, const Args&...args)
 		{
-			// Format String (recurse)
-			std::string result(formatStr);
-			std::string replaceStr = "{}";
-
-			std::string paramStr = simpleExt::toString(param);
-
-			// Find!
-			size_t index = result.find(replaceStr.c_str());
-
-			// Nothing to do...!
-			if (index < 0 || index >= result.length())
-				return result;
+			std::string result;
 
-			// Replace!
-			result.replace(index, replaceStr.length(), paramStr.c_str());
+			simpleFormat::formatTo(result, formatStr, args...);
 
 			return result;
 		}
 
-		template<isStringConvertible T, isStringConvertible...Args>
-		static std::string format(const char* formatStr, const T& param, const Args&...rest)
-		{
-			// Use the single param function overload
-			std::string result = format(formatStr, param);
-
-			return format(result.c_str(), rest...);
-		}
-
-		//template<isStringConvertible T1, isStringConvertible T2>
-		//static std::string format(const char* formatStr, const T1& param1, const T2& param2)
-		//{
-		//	// Use the single param function overload
-		//	std::string result = format(formatStr, param1);
-
-		//	return format(result, param2);
-		//}
-
-
-		//template<isStringConvertible T1, isStringConvertible T2, isStringConvertible T3>
-		//static std::string format(const char* formatStr, const T1& param1, const T2& param2, const T3& param3)
-		//{
-		//	// Use the single param function overload
-		//	std::string result = format(formatStr, param1);
-
-		//	return format(result, param2, param3);
-		//}
-
-		//template<isStringConvertible T1, isStringConvertible T2, isStringConvertible T3, isStringConvertible T4>
-		//static std::string format(const char* formatStr, const T1& param1, const T2& param2, const T3& param3, const T4& param4)
-		//{
-		//	// Use the single param function overload
-		//	std::string result = format(formatStr, param1);
-
-		//	return format(result, param2, param3, param4);
-		//}
-
-		//template<isStringConvertible T1, isStringConvertible T2, isStringConvertible T3, isStringConvertible T4, isStringConvertible T5>
-		//static std::string format(const char* formatStr, const T1& param1, const T2& param2, const T3& param3, const T4& param4, const T5& param5)
-		//{
-		//	// Use the single param function overload
-		//	std::string result = format(formatStr, param1);
-
-		//	return format(result, param2, param3, param4, param5);
-		//}
-
 		template<isStringConvertible T>
 		static std::string toString(const T& param)
 		{
@@ -132,7 +80,12 @@ namespace simple
 
 			if constexpr (isNumber<T>)
 			{
-				return std::to_string(param);
+				// Shortest round-trip form for floating point (std::to_string uses a fixed 6 decimals)
+				char buffer[64];
+
+				std::to_chars_result converted = std::to_chars(buffer, buffer + 64, param);
+
+				return std::string(buffer, converted.ptr);
 			}
 			else if constexpr (std::same_as<T, char>)
 			{
@@ -4,7 +4,10 @@
 #include "simpleDirectoryEntry.h"
 #include "simpleException.h"
 #include "simpleExt.h"
+#include "simpleMappedFile.h"
 #include "simpleString.h"
+#include "simpleStringBuilder.h"
+#include "simpleTextReader.h"
 #include <chrono>
 #include <corecrt.h>
 #include <cstring>
@@ -42,6 +45,18 @@ namespace simple
 		{
 			return bufferFile(fileName.c_str());
 		}
+		/// <summary>
+		/// (MEMORY!) Maps the file into memory (see simpleMappedFile); instead of reading it. The
+		///			  caller owns the result.
+		/// </summary>
+		static simpleMappedFile* mapFile(const char* filename, simpleMappedFileMode mode = simpleMappedFileMode::ReadOnly)
+		{
+			return new simpleMappedFile(filename, mode);
+		}
+		static simpleMappedFile* mapFile(const simpleString& filename, simpleMappedFileMode mode = simpleMappedFileMode::ReadOnly)
+		{
+			return mapFile(filename.c_str(), mode);
+		}
 		static simpleString readTextFile(const char* filename)
 		{
 			return readTextFile(simpleString(filename));
@@ -50,6 +65,20 @@ namespace simple
 		{
 			writeTextFile(simpleString(filename), contents);
 		}
+
+		/// <summary>
+		/// Streams the file line by line (see simpleTextReader); without reading it into memory
+		/// </summary>
+		static void forEachLine(const char* filename, const simpleTextReaderCallback& callback, bool validateUtf8 = false)
+		{
+			simpleTextReader reader(filename, validateUtf8);
+
+			reader.forEachLine(callback);
+		}
+		static void forEachLine(const simpleString& filename, const simpleTextReaderCallback& callback, bool validateUtf8 = false)
+		{
+			forEachLine(filename.c_str(), callback, validateUtf8);
+		}
 		static bool fileExists(const simpleString& filename)
 		{
 			bool result = false;
@@ -80,9 +109,10 @@ namespace simple
 
 				char* bufferIn = new char[fileSize];
 
-				std::ifstream stream(filename);
+				// Binary read (get(...) stops at a new line; and text mode translates line endings)
+				std::ifstream stream(filename, std::ios::in | std::ios::binary);
 
-				stream.get(bufferIn, fileSize);
+				stream.read(bufferIn, fileSize);
 				stream.close();
 
 				return new simpleBuffer(bufferIn, fileSize, false);
@@ -100,20 +130,26 @@ namespace simple
 			{
 				const char* filenameStr = filename.c_str();
 				std::ifstream stream(filenameStr);
-				simpleString result;
-				std::string line;
+				simpleStringBuilder builder;
 
-				while (std::getline(stream, line))
+				// Block reads (text mode); materialized once at the end
+				char block[65536];
+				char lastChar = '\n';
+
+				while (stream.read(block, sizeof(block)) || stream.gcount() > 0)
 				{
-					line.append("\n");
-					result.append(line.c_str());
+					builder.append(block, (int)stream.gcount());
 
-					line = "";
+					lastChar = block[stream.gcount() - 1];
 				}
 
 				stream.close();
 
-				return result;
+				// Every line ends with a new line (as with getline)
+				if (lastChar != '\n')
+					builder.append('\n');
+
+				return builder.toString();
 			}
 			catch (std::exception& ex)
 			{
@@ -0,0 +1,535 @@
+#pragma once
+
+#include "simple.h"
+#include <charconv>
+#include <concepts>
+#include <cstring>
+#include <type_traits>
+
+namespace simple
+{
+	/// <summary>
+	/// Destination for simpleFormat:  anything with append(const char*, int) (e.g. simpleString,
+	/// simpleStringBuilder, std::string)
+	/// </summary>
+	template<typename T>
+	concept isFormatSink = requires(T& sink, const char* chars, int count)
+	{
+		sink.append(chars, count);
+	};
+
+	/// <summary>
+	/// Replacement field spec:  {:[[fill]align][0][width][.precision][type]}
+	///
+	/// align:  '<' left, '>' right, '^' center (numbers default to right; text to left)
+	/// 0:  pads numbers with zeros after the sign
+	/// precision:  digits after the point (floating point only)
+	/// type:  'd' (integer); 'x' / 'X' (hex) 'b' (binary); 'f' (fixed) 'e' (scientific) 'g' (general)
+	/// </summary>
+	struct simpleFormatSpec
+	{
+		char fill = ' ';
+		char align = '\0';
+		bool zeroPad = false;
+		int width = 0;
+		int precision = -1;
+		char type = '\0';
+	};
+
+	/// <summary>
+	/// Literal text before a replacement field (or the end of the format string)
+	/// </summary>
+	struct simpleFormatLiteral
+	{
+		int offset = 0;
+		int count = 0;
+
+		// Contains "{{" / "}}" (written as single braces)
+		bool escaped = false;
+	};
+
+	/*
+		Format String:  Format string parsed at compile time (consteval) for the argument types
+
+		- Splits the format string into literals and replacement fields ("{}" or "{:spec}"); one field
+		  per argument, in order. "{{" and "}}" are written as single braces.
+		- Errors are compile errors:  field count that does not match the arguments; invalid specs; or
+		  specs that do not fit the argument type (e.g. hex for a string)
+		- Constructed implicitly from a string literal (or a constexpr const char*)
+	*/
+	template<typename...Args>
+	class simpleFormatString
+	{
+	public:
+
+		static constexpr int ArgumentCount = sizeof...(Args);
+
+	public:
+
+		template<typename TFormat>
+			requires std::convertible_to<const TFormat&, const char*>
+		consteval simpleFormatString(const TFormat& format);
+
+		const char* getFormat() const { return _format; }
+		const simpleFormatLiteral& getLiteral(int index) const { return _literals[index]; }
+		const simpleFormatSpec& getSpec(int index) const { return _specs[index]; }
+
+	private:
+
+		enum class argumentCategory
+		{
+			Character,
+			Integer,
+			FloatingPoint,
+			Text
+		};
+
+		template<typename T>
+		static consteval argumentCategory categoryOf()
+		{
+			if constexpr (isChar<T>)
+				return argumentCategory::Character;
+
+			else if constexpr (isIntLike<T>)
+				return argumentCategory::Integer;
+
+			else if constexpr (isFloatLike<T>)
+				return argumentCategory::FloatingPoint;
+
+			else
+				return argumentCategory::Text;
+		}
+
+		/// <summary>
+		/// Not constexpr:  Reaching this during constant evaluation is the compile error (the message
+		/// shows in the diagnostic)
+		/// </summary>
+		static void invalidFormatString([[maybe_unused]] const char* message) {}
+
+		consteval int parseLiteral(int index, int literalIndex);
+		consteval int parseSpec(int index, int fieldIndex);
+		consteval int parseNumber(int& index, int maxDigits);
+
+	private:
+
+		const char* _format = nullptr;
+		int _length = 0;
+
+		simpleFormatLiteral _literals[ArgumentCount + 1] = {};
+		simpleFormatSpec _specs[ArgumentCount + 1] = {};
+	};
+
+	template<typename...Args>
+	template<typename TFormat>
+		requires std::convertible_to<const TFormat&, const char*>
+	consteval simpleFormatString<Args...>::simpleFormatString(const TFormat& format)
+	{
+		_format = format;
+
+		if (_format == nullptr)
+			invalidFormatString("Format string is nullptr");
+
+		while (_format[_length] != '\0')
+			_length++;
+
+		int index = 0;
+
+		for (int fieldIndex = 0; fieldIndex <= ArgumentCount; fieldIndex++)
+		{
+			index = this->parseLiteral(index, fieldIndex);
+
+			if (index >= _length)
+			{
+				if (fieldIndex < ArgumentCount)
+					invalidFormatString("Fewer replacement fields than arguments");
+
+				return;
+			}
+
+			if (fieldIndex == ArgumentCount)
+				invalidFormatString("More replacement fields than arguments");
+
+			index = this->parseSpec(index + 1, fieldIndex);
+		}
+	}
+
+	template<typename...Args>
+	consteval int simpleFormatString<Args...>::parseLiteral(int index, int literalIndex)
+	{
+		simpleFormatLiteral& literal = _literals[literalIndex];
+
+		literal.offset = index;
+
+		while (index < _length)
+		{
+			char current = _format[index];
+			bool doubled = index + 1 < _length && _format[index + 1] == current;
+
+			if (current == '{' && !doubled)
+				break;
+
+			if (current == '}' && !doubled)
+				invalidFormatString("Unmatched '}' in format string");
+
+			if (current == '{' || current == '}')
+			{
+				literal.escaped = true;
+				index++;
+			}
+
+			index++;
+		}
+
+		literal.count = index - literal.offset;
+
+		return index;
+	}
+
+	template<typename...Args>
+	consteval int simpleFormatString<Args...>::parseSpec(int index, int fieldIndex)
+	{
+		constexpr argumentCategory categories[] = { categoryOf<std::remove_cvref_t<Args>>()..., argumentCategory::Text };
+
+		simpleFormatSpec& spec = _specs[fieldIndex];
+		argumentCategory category = categories[fieldIndex];
+
+		if (index < _length && _format[index] == ':')
+		{
+			index++;
+
+			auto isAlign = [](char character) { return character == '<' || character == '>' || character == '^'; };
+
+			// [[fill]align]
+			if (index + 1 < _length && isAlign(_format[index + 1]) && _format[index] != '{' && _format[index] != '}')
+			{
+				spec.fill = _format[index];
+				spec.align = _format[index + 1];
+				index += 2;
+			}
+			else if (index < _length && isAlign(_format[index]))
+			{
+				spec.align = _format[index];
+				index++;
+			}
+
+			// [0]
+			if (index < _length && _format[index] == '0')
+			{
+				if (category != argumentCategory::Integer && category != argumentCategory::FloatingPoint)
+					invalidFormatString("Zero padding is only valid for numbers");
+
+				spec.zeroPad = true;
+				index++;
+			}
+
+			// [width]
+			spec.width = this->parseNumber(index, 3);
+
+			// [.precision]
+			if (index < _length && _format[index] == '.')
+			{
+				if (category != argumentCategory::FloatingPoint)
+					invalidFormatString("Precision is only valid for floating point");
+
+				index++;
+
+				if (index >= _length || _format[index] < '0' || _format[index] > '9')
+					invalidFormatString("Missing precision after '.'");
+
+				spec.precision = this->parseNumber(index, 2);
+			}
+
+			// [type]
+			if (index < _length && _format[index] != '}')
+			{
+				spec.type = _format[index];
+
+				switch (spec.type)
+				{
+				case 'd':
+				case 'x':
+				case 'X':
+				case 'b':
+					if (category != argumentCategory::Integer)
+						invalidFormatString("Integer type spec for a non-integer argument");
+					break;
+				case 'f':
+				case 'e':
+				case 'g':
+					if (category != argumentCategory::FloatingPoint)
+						invalidFormatString("Floating point type spec for a non-floating point argument");
+					break;
+				default:
+					invalidFormatString("Unknown type spec");
+					break;
+				}
+
+				index++;
+			}
+		}
+
+		if (index >= _length || _format[index] != '}')
+			invalidFormatString("Missing '}' (or invalid spec) in replacement field");
+
+		return index + 1;
+	}
+
+	template<typename...Args>
+	consteval int simpleFormatString<Args...>::parseNumber(int& index, int maxDigits)
+	{
+		int result = 0;
+		int digits = 0;
+
+		while (index < _length && _format[index] >= '0' && _format[index] <= '9')
+		{
+			if (++digits > maxDigits)
+				invalidFormatString("Width / precision is too large");
+
+			result = (result * 10) + (_format[index] - '0');
+			index++;
+		}
+
+		return result;
+	}
+
+	/*
+		Format:  Writes formatted arguments into a sink (or a caller's buffer) without allocating
+
+		- The format string is parsed at compile time (see simpleFormatString); so formatting is one
+		  pass over the literals and arguments.
+		- Numbers are written with std::to_chars (shortest round-trip form for floating point unless a
+		  precision / type is given)
+		- Text arguments:  char; C strings; objects with c_str() / count() (simpleString); and other
+		  simpleObject's (toString()). Other pointers are written as "(pointer)".
+	*/
+	class simpleFormat
+	{
+	public:
+
+		/// <summary>
+		/// Appends the formatted arguments to the sink
+		/// </summary>
+		template<isFormatSink TSink, isStringConvertible...Args>
+		static void formatTo(TSink& sink, simpleFormatString<std::type_identity_t<Args>...> format, const Args&...args)
+		{
+			int index = 0;
+
+			((writeLiteral(sink, format.getFormat(), format.getLiteral(index)),
+			  writeArgument(sink, format.getSpec(index), args),
+			  index++), ...);
+
+			writeLiteral(sink, format.getFormat(), format.getLiteral(index));
+		}
+
+		/// <summary>
+		/// Writes the formatted arguments into the buffer (truncated to bufferLength - 1 characters; and
+		/// null terminated). Returns the length of the whole result; so a result that did not fit can
+		/// be detected (result >= bufferLength).
+		/// </summary>
+		template<isStringConvertible...Args>
+		static int formatTo(char* buffer, int bufferLength, simpleFormatString<std::type_identity_t<Args>...> format, const Args&...args)
+		{
+			bufferSink sink(buffer, bufferLength);
+
+			formatTo(sink, format, args...);
+
+			return sink.finish();
+		}
+
+	private:
+
+		/// <summary>
+		/// Fixed buffer sink:  Writes what fits (leaving room for the terminator); and counts the rest
+		/// </summary>
+		class bufferSink
+		{
+		public:
+
+			bufferSink(char* buffer, int bufferLength)
+			{
+				_buffer = buffer;
+				_capacity = (buffer == nullptr || bufferLength <= 0) ? -1 : bufferLength - 1;
+				_count = 0;
+			}
+
+			void append(const char* chars, int count)
+			{
+				if (_count < _capacity)
+					std::memcpy(_buffer + _count, chars, (count < _capacity - _count) ? count : _capacity - _count);
+
+				_count += count;
+			}
+
+			int finish()
+			{
+				if (_capacity >= 0)
+					_buffer[(_count < _capacity) ? _count : _capacity] = '\0';
+
+				return _count;
+			}
+
+		private:
+
+			char* _buffer;
+			int _capacity;
+			int _count;
+		};
+
+		// Fits any number written with a precision <= 99 (fixed doubles run to ~310 digits)
+		static constexpr int NumberBufferSize = 512;
+
+		template<isFormatSink TSink>
+		static void writeLiteral(TSink& sink, const char* format, const simpleFormatLiteral& literal)
+		{
+			const char* chars = format + literal.offset;
+
+			if (!literal.escaped)
+			{
+				if (literal.count > 0)
+					sink.append(chars, literal.count);
+
+				return;
+			}
+
+			// Doubled braces:  Write the first of each pair
+			int start = 0;
+
+			for (int index = 0; index < literal.count; index++)
+			{
+				if (chars[index] == '{' || chars[index] == '}')
+				{
+					sink.append(chars + start, index + 1 - start);
+
+					index++;
+					start = index + 1;
+				}
+			}
+
+			if (start < literal.count)
+				sink.append(chars + start, literal.count - start);
+		}
+
+		template<isFormatSink TSink>
+		static void writeFill(TSink& sink, char fill, int count)
+		{
+			char fillChars[16];
+
+			std::memset(fillChars, fill, sizeof(fillChars));
+
+			while (count > 0)
+			{
+				int fillCount = (count < 16) ? count : 16;
+
+				sink.append(fillChars, fillCount);
+
+				count -= fillCount;
+			}
+		}
+
+		/// <summary>
+		/// Writes the characters padded to the spec's width
+		/// </summary>
+		template<isFormatSink TSink>
+		static void writePadded(TSink& sink, const simpleFormatSpec& spec, const char* chars, int count, bool isNumber)
+		{
+			int padding = spec.width - count;
+
+			if (padding <= 0)
+			{
+				sink.append(chars, count);
+				return;
+			}
+
+			// Zeros go between the sign and the digits
+			if (spec.zeroPad && spec.align == '\0')
+			{
+				if (count > 0 && chars[0] == '-')
+				{
+					sink.append(chars, 1);
+					chars++;
+					count--;
+				}
+
+				writeFill(sink, '0', padding);
+				sink.append(chars, count);
+				return;
+			}
+
+			char align = (spec.align != '\0') ? spec.align : (isNumber ? '>' : '<');
+			int leftPadding = (align == '<') ? 0 : (align == '>') ? padding : padding / 2;
+
+			writeFill(sink, spec.fill, leftPadding);
+			sink.append(chars, count);
+			writeFill(sink, spec.fill, padding - leftPadding);
+		}
+
+		template<isFormatSink TSink, typename T>
+		static void writeArgument(TSink& sink, const simpleFormatSpec& spec, const T& value)
+		{
+			if constexpr (isChar<T>)
+			{
+				writePadded(sink, spec, &value, 1, false);
+			}
+			else if constexpr (isIntLike<T>)
+			{
+				char buffer[NumberBufferSize];
+				int base = (spec.type == 'x' || spec.type == 'X') ? 16 : (spec.type == 'b') ? 2 : 10;
+
+				char* end = std::to_chars(buffer, buffer + NumberBufferSize, value, base).ptr;
+
+				if (spec.type == 'X')
+				{
+					for (char* current = buffer; current < end; current++)
+					{
+						if (*current >= 'a' && *current <= 'f')
+							*current -= 'a' - 'A';
+					}
+				}
+
+				writePadded(sink, spec, buffer, (int)(end - buffer), true);
+			}
+			else if constexpr (isFloatLike<T>)
+			{
+				char buffer[NumberBufferSize];
+				char* end;
+
+				std::chars_format format = (spec.type == 'f') ? std::chars_format::fixed :
+										   (spec.type == 'e') ? std::chars_format::scientific :
+										   std::chars_format::general;
+
+				// Shortest round-trip
+				if (spec.precision < 0 && spec.type == '\0')
+					end = std::to_chars(buffer, buffer + NumberBufferSize, value).ptr;
+
+				// Fixed / scientific / general default to 6 digits (as printf)
+				else
+					end = std::to_chars(buffer, buffer + NumberBufferSize, value, format, (spec.precision < 0) ? 6 : spec.precision).ptr;
+
+				writePadded(sink, spec, buffer, (int)(end - buffer), true);
+			}
+			else if constexpr (requires { value.c_str(); value.count(); })
+			{
+				writePadded(sink, spec, value.c_str(), value.count(), false);
+			}
+			else if constexpr (isStringLike<T>)
+			{
+				const char* chars = value;
+
+				if (chars == nullptr)
+					chars = "(null)";
+
+				writePadded(sink, spec, chars, (int)strlen(chars), false);
+			}
+			else if constexpr (isSimpleObject<T>)
+			{
+				const char* chars = value.toString();
+
+				writePadded(sink, spec, chars, (int)strlen(chars), false);
+			}
+			else
+			{
+				writePadded(sink, spec, "(pointer)", 9, false);
+			}
+		}
+	};
+}
@@ -5,18 +5,28 @@
 #include "simpleHashCore.h"
 #include "simpleHashStdCore.h"
 #include "simpleHashBasicCore.h"
+#include "simpleHashDynamicCore.h"
 #include "simpleList.h"
 #include "simplePair.h"
 
 namespace simple
 {
-	template<isHashable K, typename V>
+	/// <summary>
+	/// Key-value hash table. The backend (TCore) is a template policy stored inline - so there is no
+	/// core allocation; and calls to a concrete core are not virtual. Use simpleHashDynamicCore to
+	/// choose the backend at runtime.
+	/// </summary>
+	template<isHashable K, typename V, isHashCore<K, V> TCore = simpleHashBasicCore<K, V>>
 	class simpleHash : public simpleObject
 	{
 	public:
 		simpleHash();
+		simpleHash(simpleHashBackend backend) requires std::constructible_from<TCore, simpleHashBackend>;
+		simpleHash(const simpleHash<K, V, TCore>& copy);
 		~simpleHash();
 
+		void operator=(const simpleHash<K, V, TCore>& copy);
+
 		V get(const K& key) const;
 		void add(const K& key, const V& value);
 		void set(const K& key, const V& value);
@@ -31,6 +41,15 @@ namespace simple
 
 		void iterate(const simpleHashCallback<K, V>& callback) const;
 
+	public:	// Heterogeneous lookup (e.g. simpleStringView / const char* for simpleString keys). The
+			// basic / std cores do not construct a K for the lookup; the dynamic core converts to K.
+
+		template<isHashLookup<K> TLookup>
+		V get(const TLookup& key) const;
+
+		template<isHashLookup<K> TLookup>
+		bool contains(const TLookup& key) const;
+
 	public:	// Extension Methods:  mostly queries
 
 		bool any(const simpleHashPredicate<K, V>& predicate);
@@ -49,7 +68,7 @@ namespace simple
 		/// Returns a stack-copyable simpleHash table for key-value pairs except for those
 		/// indicated by a truthy predicate.
 		/// </summary>
-		simpleHash<K, V> except(const simpleHashPredicate<K, V>& predicate) const;
+		simpleHash<K, V, TCore> except(const simpleHashPredicate<K, V>& predicate) const;
 
 		simpleList<K> getKeys() const;
 		simpleList<V> getValues() const;
@@ -60,79 +79,108 @@ namespace simple
 
 	private:
 
-		simpleHashCore<K, V>* _core;
+		TCore _core;
 
 	};
 
-	template<isHashable K, typename V>
-	simpleHash<K, V>::simpleHash()
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleHash<K, V, TCore>::simpleHash()
+	{
+	}
+
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleHash<K, V, TCore>::simpleHash(simpleHashBackend backend) requires std::constructible_from<TCore, simpleHashBackend>
+		: _core(backend)
+	{
+	}
+
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleHash<K, V, TCore>::simpleHash(const simpleHash<K, V, TCore>& copy)
+		: _core(copy._core)
+	{
+	}
+
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleHash<K, V, TCore>::~simpleHash()
+	{
+	}
+
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::operator=(const simpleHash<K, V, TCore>& copy)
+	{
+		_core = copy._core;
+	}
+
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::clear()
 	{
-		//_core = new simpleHashStdCore<K, V>();
-		_core = new simpleHashBasicCore<K, V>();
+		_core.clear();
 	}
 
-	template<isHashable K, typename V>
-	simpleHash<K, V>::~simpleHash()
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	V simpleHash<K, V, TCore>::get(const K& key) const
 	{
-		delete _core;
+		return _core.get(key);
 	}
 
-	template<isHashable K, typename V>
-	void simpleHash<K, V>::clear()
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	template<isHashLookup<K> TLookup>
+	V simpleHash<K, V, TCore>::get(const TLookup& key) const
 	{
-		_core->clear();
+		return _core.get(key);
 	}
 
-	template<isHashable K, typename V>
-	V simpleHash<K, V>::get(const K& key) const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	template<isHashLookup<K> TLookup>
+	bool simpleHash<K, V, TCore>::contains(const TLookup& key) const
 	{
-		return _core->get(key);
+		return _core.contains(key);
 	}
 
-	template<isHashable K, typename V>
-	simplePair<K, V>* simpleHash<K, V>::getAt(int index)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simplePair<K, V>* simpleHash<K, V, TCore>::getAt(int index)
 	{
-		return _core->getAt(index);
+		return _core.getAt(index);
 	}
 
-	template<isHashable K, typename V>
-	void simpleHash<K, V>::add(const K& key, const V& value)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::add(const K& key, const V& value)
 	{
-		_core->add(key, value);
+		_core.add(key, value);
 	}
 
-	template<isHashable K, typename V>
-	void simpleHash<K, V>::set(const K& key, const V& value)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::set(const K& key, const V& value)
 	{
-		_core->set(key, value);
+		_core.set(key, value);
 	}
 
-	template<isHashable K, typename V>
-	bool simpleHash<K, V>::remove(const K& key)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	bool simpleHash<K, V, TCore>::remove(const K& key)
 	{
-		return _core->remove(key);
+		return _core.remove(key);
 	}
 
-	template<isHashable K, typename V>
-	bool simpleHash<K, V>::contains(const K& key) const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	bool simpleHash<K, V, TCore>::contains(const K& key) const
 	{
-		return _core->contains(key);
+		return _core.contains(key);
 	}
 
-	template<isHashable K, typename V>
-	int simpleHash<K, V>::count() const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	int simpleHash<K, V, TCore>::count() const
 	{
-		return _core->count();
+		return _core.count();
 	}
 
-	template<isHashable K, typename V>
-	void simpleHash<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::iterate(const simpleHashCallback<K, V>& callback) const
 	{
-		_core->iterate(callback);
+		_core.iterate(callback);
 	}
 
-	template<isHashable K, typename V>
-	bool simpleHash<K, V>::any(const simpleHashPredicate<K, V>& predicate)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	bool simpleHash<K, V, TCore>::any(const simpleHashPredicate<K, V>& predicate)
 	{
 		bool result = false;
 
@@ -150,13 +198,13 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	simpleList<simplePair<K, V>> simpleHash<K, V>::removeWhere(const simpleHashPredicate<K, V>& predicate)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleList<simplePair<K, V>> simpleHash<K, V, TCore>::removeWhere(const simpleHashPredicate<K, V>& predicate)
 	{
 		simpleList<simplePair<K, V>> result;
 
 		// Mark the remove elements
-		_core->iterate([&result, &predicate] (const K& key, const V& value)
+		_core.iterate([&result, &predicate] (const K& key, const V& value)
 		{
 			if (predicate(key, value))
 			{
@@ -169,23 +217,23 @@ namespace simple
 		// Remove the indicated elements (Check Memory related issues!)
 		for (int index = 0; index < result.count(); index++)
 		{
-			_core->remove(result.get(index).getKey());
+			_core.remove(result.get(index).getKey());
 		}
 
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	K simpleHash<K, V>::firstKey()
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	K simpleHash<K, V, TCore>::firstKey()
 	{
 		if (this->count() == 0)
 			throw simpleException("Trying to access empty simpleHash:  simpleHash::firstKey");
 
-		return _core->getAt(0)->getKey();
+		return _core.getAt(0)->getKey();
 	}
 
-	template<isHashable K, typename V>
-	K simpleHash<K, V>::firstKey(const simpleHashPredicate<K, V>& predicate)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	K simpleHash<K, V, TCore>::firstKey(const simpleHashPredicate<K, V>& predicate)
 	{
 		K result = default_value::value<K>();
 
@@ -203,14 +251,14 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	V simpleHash<K, V>::firstValue()
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	V simpleHash<K, V, TCore>::firstValue()
 	{
-		return _core->getAt(0)->getValue();
+		return _core.getAt(0)->getValue();
 	}
 
-	template<isHashable K, typename V>
-	V simpleHash<K, V>::firstValue(const simpleHashPredicate<K, V>& predicate)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	V simpleHash<K, V, TCore>::firstValue(const simpleHashPredicate<K, V>& predicate)
 	{
 		V result = default_value::value<V>();
 
@@ -226,13 +274,13 @@ namespace simple
 		});
 
 		if (result == default_value::value<V>())
-			throw simpleException("No predicate match:  simpleHash<K, V>::firstValue");
+			throw simpleException("No predicate match:  simpleHash<K, V, TCore>::firstValue");
 
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	void simpleHash<K, V>::forEach(const simpleHashCallback<K, V>& callback)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	void simpleHash<K, V, TCore>::forEach(const simpleHashCallback<K, V>& callback)
 	{
 		this->iterate([&callback] (K key, V value)
 		{
@@ -240,8 +288,8 @@ namespace simple
 		});
 	}
 
-	template<isHashable K, typename V>
-	K simpleHash<K, V>::firstOrDefaultKey(const simpleHashPredicate<K, V>& predicate)
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	K simpleHash<K, V, TCore>::firstOrDefaultKey(const simpleHashPredicate<K, V>& predicate)
 	{
 		K result = default_value::value<K>();
 
@@ -259,9 +307,9 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
 	template<typename VResult>
-	simpleList<VResult> simpleHash<K, V>::selectFromValues(const simpleHashSelector<K, V, VResult>& selector)
+	simpleList<VResult> simpleHash<K, V, TCore>::selectFromValues(const simpleHashSelector<K, V, VResult>& selector)
 	{
 		simpleList<VResult> result;
 
@@ -274,10 +322,10 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	simpleHash<K, V> simpleHash<K, V>::except(const simpleHashPredicate<K, V>& predicate) const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleHash<K, V, TCore> simpleHash<K, V, TCore>::except(const simpleHashPredicate<K, V>& predicate) const
 	{
-		simpleHash<K, V> result;
+		simpleHash<K, V, TCore> result;
 
 		this->iterate([&result, &predicate] (const K& key, const V& value)
 		{
@@ -290,8 +338,8 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	simpleList<K> simpleHash<K, V>::getKeys() const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleList<K> simpleHash<K, V, TCore>::getKeys() const
 	{
 		simpleList<K> result;
 
@@ -305,8 +353,8 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	simpleList<V> simpleHash<K, V>::getValues() const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	simpleList<V> simpleHash<K, V, TCore>::getValues() const
 	{
 		simpleList<V> result;
 
@@ -320,8 +368,8 @@ namespace simple
 		return result;
 	}
 
-	template<isHashable K, typename V>
-	size_t simpleHash<K, V>::getHash() const
+	template<isHashable K, typename V, isHashCore<K, V> TCore>
+	size_t simpleHash<K, V, TCore>::getHash() const
 	{
 		size_t hash = 0;
 
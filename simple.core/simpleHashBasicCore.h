@@ -7,17 +7,34 @@
 #include "simpleException.h"
 #include "simpleHashCore.h"
 #include "simpleMath.h"
+#include <memory>
+#include <new>
 
 namespace simple
 {
+	/// <summary>
+	/// Default simpleHash core:  the first SmallCapacity entries are stored inline and found by a linear
+	/// probe (comparing the stored hash codes first). The bucket table is allocated when that overflows;
+	/// so an empty (or small) hash table does no heap allocation.
+	/// </summary>
 	template<isHashable K, typename V>
-	class simpleHashBasicCore : public simpleHashCore<K, V>
+	class simpleHashBasicCore final : public simpleHashCore<K, V>
 	{
+	public:
+
+		/// <summary>
+		/// Number of entries stored inline before the bucket table is allocated
+		/// </summary>
+		static constexpr int SmallCapacity = 8;
+
 	public:
 
 		simpleHashBasicCore();
+		simpleHashBasicCore(const simpleHashBasicCore<K, V>& copy);
 		~simpleHashBasicCore();
 
+		void operator=(const simpleHashBasicCore<K, V>& copy);
+
 		V get(const K& key) const override;
 		void add(const K& key, const V& value) override;
 		void set(const K& key, const V& value) override;
@@ -30,6 +47,14 @@ namespace simple
 		bool remove(const K& key) override;
 		void clear() override;
 
+	public:	// Heterogeneous lookup (no K is constructed for the lookup)
+
+		template<isHashLookup<K> TLookup>
+		V get(const TLookup& key) const;
+
+		template<isHashLookup<K> TLookup>
+		bool contains(const TLookup& key) const;
+
 	public:
 
 		simpleList<K> getKeys() const;
@@ -41,13 +66,30 @@ namespace simple
 		size_t calculateBucketIndex(size_t hashCode) const;
 		void rehash(size_t newSize);
 
+		bool isSmall() const;
+		simplePair<K, V>* smallAt(int index);
+		const simplePair<K, V>* smallAt(int index) const;
+
+		template<typename TLookup>
+		int smallIndexOf(const TLookup& key, size_t hashCode) const;
+
+		template<typename TLookup>
+		simplePair<K, V>* tableFind(const TLookup& key, size_t hashCode) const;
+
+		void tableAdd(simplePair<K, V>* pair, size_t hashCode);
+
 	private:
 
-		// Static Hash Table (with dynamic buckets)
+		// Small Mode (_table == nullptr):  inline entries (insertion order) with their hash codes
+		alignas(simplePair<K, V>) unsigned char _smallBuffer[SmallCapacity * sizeof(simplePair<K, V>)];
+		size_t _smallHashes[SmallCapacity];
+		int _smallCount;
+
+		// Static Hash Table (with dynamic buckets - allocated on first use)
 		simpleArray<simpleList<simplePair<K, V>*>*>* _table;
 
-		// List follower for the primary table - for index lookup
-		simpleList<simplePair<K, V>*>* _list;
+		// List follower for the primary table - for index lookup (insertion order)
+		simpleList<simplePair<K, V>*> _list;
 
 		// Bucket Sizes (prevents iteration of bucket lists during set(..))
 		int _maxBucketSize;
@@ -56,33 +98,41 @@ namespace simple
 	template<isHashable K, typename V>
 	simpleHashBasicCore<K, V>::simpleHashBasicCore()
 	{
-		_table = new simpleArray<simpleList<simplePair<K, V>*>*>(100);
-		_list = new simpleList<simplePair<K, V>*>();
+		_smallCount = 0;
+		_table = nullptr;
 		_maxBucketSize = 0;
+	}
 
-		// (MEMORY!)
-		for (int index = 0; index < _table->count(); index++)
+	template<isHashable K, typename V>
+	simpleHashBasicCore<K, V>::simpleHashBasicCore(const simpleHashBasicCore<K, V>& copy)
+		: simpleHashBasicCore()
+	{
+		copy.iterate([this] (const K& key, const V& value)
 		{
-			_table->set(index, new simpleList<simplePair<K, V>*>());
-		}
+			this->add(key, value);
+			return iterationCallback::iterate;
+		});
 	}
 
 	template<isHashable K, typename V>
-	simpleHashBasicCore<K, V>::~simpleHashBasicCore()
+	void simpleHashBasicCore<K, V>::operator=(const simpleHashBasicCore<K, V>& copy)
 	{
-		// (MEMORY!)
-		for (int arrayIndex = 0; arrayIndex < _table->count(); arrayIndex++)
-		{
-			for (int index = 0; index < _table->get(arrayIndex)->count(); index++)
-			{
-				delete _table->get(arrayIndex)->get(index);
-			}
+		if (this == &copy)
+			return;
 
-			delete _table->get(arrayIndex);
-		}
+		this->clear();
 
-		delete _table;
-		delete _list;
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			this->add(key, value);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable K, typename V>
+	simpleHashBasicCore<K, V>::~simpleHashBasicCore()
+	{
+		this->clear();
 	}
 
 	template<isHashable K, typename V>
@@ -97,69 +147,185 @@ namespace simple
 		return hashCode % _table->count();
 	}
 
+	template<isHashable K, typename V>
+	bool simpleHashBasicCore<K, V>::isSmall() const
+	{
+		return _table == nullptr;
+	}
+
+	template<isHashable K, typename V>
+	simplePair<K, V>* simpleHashBasicCore<K, V>::smallAt(int index)
+	{
+		return std::launder(reinterpret_cast<simplePair<K, V>*>(_smallBuffer)) + index;
+	}
+
+	template<isHashable K, typename V>
+	const simplePair<K, V>* simpleHashBasicCore<K, V>::smallAt(int index) const
+	{
+		return std::launder(reinterpret_cast<const simplePair<K, V>*>(_smallBuffer)) + index;
+	}
+
+	template<isHashable K, typename V>
+	template<typename TLookup>
+	int simpleHashBasicCore<K, V>::smallIndexOf(const TLookup& key, size_t hashCode) const
+	{
+		for (int index = 0; index < _smallCount; index++)
+		{
+			if (_smallHashes[index] == hashCode && this->smallAt(index)->getKey() == key)
+				return index;
+		}
+
+		return -1;
+	}
+
+	template<isHashable K, typename V>
+	template<typename TLookup>
+	simplePair<K, V>* simpleHashBasicCore<K, V>::tableFind(const TLookup& key, size_t hashCode) const
+	{
+		simpleList<simplePair<K, V>*>* bucket = _table->get(this->calculateBucketIndex(hashCode));
+
+		if (bucket == nullptr)
+			return nullptr;
+
+		// TODO: Use Ordered List
+		for (int index = 0; index < bucket->count(); index++)
+		{
+			if (bucket->get(index)->getKey() == key)
+				return bucket->get(index);
+		}
+
+		return nullptr;
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashBasicCore<K, V>::tableAdd(simplePair<K, V>* pair, size_t hashCode)
+	{
+		size_t bucketIndex = this->calculateBucketIndex(hashCode);
+
+		// (MEMORY!) Buckets are created on first use
+		if (_table->get(bucketIndex) == nullptr)
+			_table->set(bucketIndex, new simpleList<simplePair<K, V>*>());
+
+		_table->get(bucketIndex)->add(pair);
+
+		// Track the bucket size while we're here
+		if (_table->get(bucketIndex)->count() > _maxBucketSize)
+			_maxBucketSize = _table->get(bucketIndex)->count();
+	}
+
 	template<isHashable K, typename V>
 	void simpleHashBasicCore<K, V>::rehash(size_t newSize)
 	{
-		// Setup new hash table with the specified size limit
-		simpleArray<simpleList<simplePair<K, V>*>*>* newTable = new simpleArray<simpleList<simplePair<K, V>*>*>(newSize);
+		// Setup new hash table with the specified size limit (buckets are null until used)
+		simpleArray<simpleList<simplePair<K, V>*>*>* oldTable = _table;
 
-		// Setup new follower list for indexOf retrieval
-		simpleList<simplePair<K, V>*>* newList = new simpleList<simplePair<K, V>*>();
+		_table = new simpleArray<simpleList<simplePair<K, V>*>*>(newSize);
 
 		// Reset the max bucket size tracker
 		_maxBucketSize = 0;
 
-		for (int index = 0; index < _table->count(); index++)
+		// Small Mode -> Table:  move the inline entries to the heap
+		if (oldTable == nullptr)
 		{
-			for (int bucketIndex = 0; bucketIndex < _table->get(index)->count(); bucketIndex++)
+			for (int index = 0; index < _smallCount; index++)
 			{
-				// Get details from each bucket copied over
-				simplePair<K, V>* pair = _table->get(index)->get(bucketIndex);
+				simplePair<K, V>* pair = new simplePair<K, V>(*this->smallAt(index));
 
-				size_t hashCode = this->calculateHashCode(pair->getKey());
-				size_t newBucketIndex = hashCode % newSize;		// Find a bucket for the data
+				this->tableAdd(pair, _smallHashes[index]);
+				_list.add(pair);
+			}
 
-				if (newTable->get(newBucketIndex) == nullptr)
-					newTable->set(newBucketIndex, new simpleList<simplePair<K, V>*>());
+			std::destroy_n(this->smallAt(0), _smallCount);
 
-				newTable->get(newBucketIndex)->add(pair);
-				newList->add(pair);
+			_smallCount = 0;
+		}
 
-				// Track the new bucket size while we're here
-				if (newTable->get(newBucketIndex)->count() > _maxBucketSize)
-					_maxBucketSize = newTable->get(newBucketIndex)->count();
+		// Table -> Table:  the follower list keeps the insertion order
+		else
+		{
+			for (int index = 0; index < _list.count(); index++)
+			{
+				simplePair<K, V>* pair = _list.get(index);
+
+				this->tableAdd(pair, this->calculateHashCode(pair->getKey()));
 			}
-		}
 
-		// Delete the old data container
-		delete _table;
-		delete _list;
+			// Delete the old data container (the pairs were moved)
+			for (int index = 0; index < oldTable->count(); index++)
+				delete oldTable->get(index);
 
-		// Set the new pointer
-		_table = newTable;
-		_list = newList;
+			delete oldTable;
+		}
 	}
 
 	template<isHashable K, typename V>
 	void simpleHashBasicCore<K, V>::clear()
 	{
-		simpleList<K> keys = this->getKeys();
+		if (this->isSmall())
+		{
+			std::destroy_n(this->smallAt(0), _smallCount);
+
+			_smallCount = 0;
+			return;
+		}
+
+		// (MEMORY!)
+		for (int index = 0; index < _list.count(); index++)
+			delete _list.get(index);
+
+		for (int index = 0; index < _table->count(); index++)
+			delete _table->get(index);
+
+		delete _table;
 
-		for (int index = 0; index < keys.count(); index++)
-			this->remove(keys.get(index));
+		// Back to small mode
+		_table = nullptr;
+		_list.clear();
+		_maxBucketSize = 0;
 	}
 
 	template<isHashable K, typename V>
 	V simpleHashBasicCore<K, V>::get(const K& key) const
 	{
 		size_t hashCode = this->calculateHashCode(key);
-		size_t bucketIndex = this->calculateBucketIndex(hashCode);
 
-		// TODO: Use Ordered List
-		for (int index = 0; index < _table->get(bucketIndex)->count(); index++)
+		if (this->isSmall())
 		{
-			if (_table->get(bucketIndex)->get(index)->getKey() == key)
-				return _table->get(bucketIndex)->get(index)->getValue();
+			int index = this->smallIndexOf(key, hashCode);
+
+			if (index >= 0)
+				return this->smallAt(index)->getValue();
+		}
+		else
+		{
+			simplePair<K, V>* pair = this->tableFind(key, hashCode);
+
+			if (pair != nullptr)
+				return pair->getValue();
+		}
+
+		throw simpleException("Key not found in hash table:  simpleHash.cpp");
+	}
+
+	template<isHashable K, typename V>
+	template<isHashLookup<K> TLookup>
+	V simpleHashBasicCore<K, V>::get(const TLookup& key) const
+	{
+		size_t hashCode = simpleHashStdKey::hash(key);
+
+		if (this->isSmall())
+		{
+			int index = this->smallIndexOf(key, hashCode);
+
+			if (index >= 0)
+				return this->smallAt(index)->getValue();
+		}
+		else
+		{
+			simplePair<K, V>* pair = this->tableFind(key, hashCode);
+
+			if (pair != nullptr)
+				return pair->getValue();
 		}
 
 		throw simpleException("Key not found in hash table:  simpleHash.cpp");
@@ -168,21 +334,40 @@ namespace simple
 	template<isHashable K, typename V>
 	simplePair<K, V>* simpleHashBasicCore<K, V>::getAt(int index)
 	{
-		return _list->get(index);
+		if (index < 0 || index >= this->count())
+			throw simpleException("Index outside the bounds of the simpleHash:  simpleHashBasicCore::getAt");
+
+		if (this->isSmall())
+			return this->smallAt(index);
+
+		return _list.get(index);
 	}
 
 	template<isHashable K, typename V>
 	void simpleHashBasicCore<K, V>::add(const K& key, const V& value)
 	{
-		if (this->contains(key))
-			throw simpleException("Trying to add duplicate value to simpleHash table. Use set(...)");
+		size_t hashCode = this->calculateHashCode(key);
 
-		// Check hash integrity
-		//checkHash();
+		if (this->isSmall())
+		{
+			if (this->smallIndexOf(key, hashCode) >= 0)
+				throw simpleException("Trying to add duplicate value to simpleHash table. Use set(...)");
 
-		// First rehash will give 100 buckets
-		if (_table->count() == 0)
+			// Inline entry
+			if (_smallCount < SmallCapacity)
+			{
+				std::construct_at(this->smallAt(_smallCount), key, value);
+
+				_smallHashes[_smallCount++] = hashCode;
+				return;
+			}
+
+			// First rehash will give 100 buckets
 			rehash(100);
+		}
+
+		else if (this->tableFind(key, hashCode) != nullptr)
+			throw simpleException("Trying to add duplicate value to simpleHash table. Use set(...)");
 
 		// Decision to rehash:
 		//
@@ -200,128 +385,166 @@ namespace simple
 
 		// If there's still overflow, the max size will be set for the next call to set(..)
 		//
-		size_t hashCode = this->calculateHashCode(key);
-		size_t bucketIndex = this->calculateBucketIndex(hashCode);
 
 		// (MEMORY!) Add to the i-th bucket
 		//
 		simplePair<K, V>* pair = new simplePair<K, V>(key, value);
 
-		_table->get(bucketIndex)->add(pair);
-		_list->add(pair);
+		this->tableAdd(pair, hashCode);
+		_list.add(pair);
 	}
 
 	template<isHashable K, typename V>
 	void simpleHashBasicCore<K, V>::set(const K& key, const V& value)
 	{
-		if (!this->contains(key))
-			throw simpleException("Trying to set value for a key-value pair that doesn't exist. Use add(...)");
-
-		V oldValue = this->get(key);
-
-		// Iterate to find the location in the ith bucket
 		size_t hashCode = this->calculateHashCode(key);
-		size_t bucketIndex = this->calculateBucketIndex(hashCode);
+		simplePair<K, V>* pair = nullptr;
 
-		// Iterate to set the item value
-		for (int index = 0; index < _table->get(bucketIndex)->count(); index++)
+		if (this->isSmall())
 		{
-			if (_table->get(bucketIndex)->get(index)->getValue() == oldValue)
-			{
-				simplePair<K, V>* pair = _table->get(bucketIndex)->get(index);
+			int index = this->smallIndexOf(key, hashCode);
 
-				pair->setValue(value);
-				break;
-			}
+			if (index >= 0)
+				pair = this->smallAt(index);
 		}
+		else
+			pair = this->tableFind(key, hashCode);
+
+		if (pair == nullptr)
+			throw simpleException("Trying to set value for a key-value pair that doesn't exist. Use add(...)");
+
+		pair->setValue(value);
 	}
 
 	template<isHashable K, typename V>
 	bool simpleHashBasicCore<K, V>::remove(const K& key)
 	{
 		size_t hashCode = this->calculateHashCode(key);
-		size_t bucketIndex = this->calculateBucketIndex(hashCode);
 
+		if (this->isSmall())
+		{
+			int removeIndex = this->smallIndexOf(key, hashCode);
+
+			if (removeIndex < 0)
+				return false;
+
+			// Shift the remaining entries down (keeps insertion order)
+			for (int index = removeIndex; index < _smallCount - 1; index++)
+			{
+				*this->smallAt(index) = *this->smallAt(index + 1);
+				_smallHashes[index] = _smallHashes[index + 1];
+			}
+
+			std::destroy_at(this->smallAt(_smallCount - 1));
+
+			_smallCount--;
+
+			return true;
+		}
+
+		simpleList<simplePair<K, V>*>* bucket = _table->get(this->calculateBucketIndex(hashCode));
 		simplePair<K, V>* item = nullptr;
 
+		if (bucket == nullptr)
+			return false;
+
 		// TODO: Use Ordered List
-		for (int index = 0; index < _table->get(bucketIndex)->count(); index++)
+		for (int index = 0; index < bucket->count(); index++)
 		{
-			if (_table->get(bucketIndex)->get(index)->getKey() == key)
+			if (bucket->get(index)->getKey() == key)
 			{
 				// Check max bucket size / track
-				if (_table->get(bucketIndex)->count() == _maxBucketSize)
+				if (bucket->count() == _maxBucketSize)
 					_maxBucketSize--;
 
 				// Save item pointer
-				item = _table->get(bucketIndex)->get(index);
+				item = bucket->get(index);
 
 				// Remove from the array
-				_table->get(bucketIndex)->removeAt(index);
+				bucket->removeAt(index);
+				break;
 			}
 		}
 
+		if (item == nullptr)
+			return false;
+
 		// TODO: Use Ordered List
-		for (int index = 0; index < _list->count(); index++)
+		for (int index = 0; index < _list.count(); index++)
 		{
-			if (_list->get(index)->getKey() == key)
+			if (_list.get(index) == item)
 			{
 				// Remove from the parallel list
-				_list->removeAt(index);
+				_list.removeAt(index);
 				break;
 			}
 		}
 
-		if (item != nullptr)
-		{
-			delete item;
-			return true;
-		}
+		delete item;
 
-		return false;
+		return true;
 	}
 
 	template<isHashable K, typename V>
 	bool simpleHashBasicCore<K, V>::contains(const K& key) const
 	{
 		size_t hashCode = this->calculateHashCode(key);
-		size_t bucketIndex = this->calculateBucketIndex(hashCode);
 
-		if (bucketIndex < 0 ||
-			bucketIndex >= _table->count())
-			return false;
+		if (this->isSmall())
+			return this->smallIndexOf(key, hashCode) >= 0;
 
-		// TODO: Use Ordered List
-		for (int index = 0; index < _table->get(bucketIndex)->count(); index++)
-		{
-			if (_table->get(bucketIndex)->get(index)->getKey() == key)
-				return true;
-		}
+		return this->tableFind(key, hashCode) != nullptr;
+	}
 
-		return false;
+	template<isHashable K, typename V>
+	template<isHashLookup<K> TLookup>
+	bool simpleHashBasicCore<K, V>::contains(const TLookup& key) const
+	{
+		size_t hashCode = simpleHashStdKey::hash(key);
+
+		if (this->isSmall())
+			return this->smallIndexOf(key, hashCode) >= 0;
+
+		return this->tableFind(key, hashCode) != nullptr;
 	}
 
 	template<isHashable K, typename V>
 	int simpleHashBasicCore<K, V>::count() const
 	{
-		return _list->count();
+		return this->isSmall() ? _smallCount : _list.count();
 	}
 
 	template<isHashable K, typename V>
 	simpleList<K> simpleHashBasicCore<K, V>::getKeys() const
 	{
-		return _list->select<K>([] (simplePair<K, V>* pair)
+		simpleList<K> result;
+
+		this->iterate([&result] (const K& key, const V& value)
 		{
-			return pair->getKey();
+			result.add(key);
+			return iterationCallback::iterate;
 		});
+
+		return result;
 	}
 
 	template<isHashable K, typename V>
 	void simpleHashBasicCore<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
 	{
-		_list->forEach([&callback] (simplePair<K, V>* pair)
+		if (this->isSmall())
+		{
+			for (int index = 0; index < _smallCount; index++)
+			{
+				if (callback(this->smallAt(index)->getKey(), this->smallAt(index)->getValue()) == iterationCallback::breakAndReturn)
+					break;
+			}
+
+			return;
+		}
+
+		_list.forEach([&callback] (simplePair<K, V>* pair)
 		{
 			return callback(pair->getKey(), pair->getValue());
 		});
 	}
-}
\ No newline at end of file
+}
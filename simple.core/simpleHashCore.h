@@ -3,7 +3,11 @@
 #include "simple.h"
 #include "simplePair.h"
 #include "simpleException.h"
+#include <concepts>
+#include <cstring>
 #include <functional>
+#include <random>
+#include <type_traits>
 
 namespace simple
 {
@@ -25,6 +29,90 @@ namespace simple
 	template<isHashable K, isHashable V, typename VResult>
 	using simpleHashSelector = std::function<VResult(const V& value)>;
 
+	/// <summary>
+	/// Lookup type that may be used in place of the key type K (e.g. const char* for simpleString
+	/// keys; or simpleStringView). Must be comparable to K; and hash the same as an equal K (see
+	/// simpleHashStdKey::hash):  so only character strings and getHash() types qualify. Others (e.g.
+	/// std::string, numbers) are converted to K by the K overloads; their own hash would not match.
+	/// </summary>
+	template<typename TLookup, typename K>
+	concept isHashLookup = !std::same_as<std::remove_cvref_t<TLookup>, K> &&
+		(std::convertible_to<const TLookup&, const char*> || isHashableValue<std::remove_cvref_t<TLookup>>) &&
+		requires(const K& key, const TLookup& lookup)
+		{
+			{ key == lookup } -> std::convertible_to<bool>;
+		};
+
+	/// <summary>
+	/// Key hashing for heterogeneous lookup (basic / std cores). Character strings are hashed by
+	/// content (matching simpleString::getHash()); so either may be used to look up the other.
+	/// </summary>
+	struct simpleHashStdKey
+	{
+		template<typename T>
+		static size_t hash(const T& key)
+		{
+			if constexpr (std::convertible_to<const T&, const char*>)
+			{
+				const char* chars = key;
+
+				return hashGenerator::generateBytesHash(chars, (chars == nullptr) ? 0 : std::strlen(chars));
+			}
+			else
+				return hashGenerator::generateHash(key);
+		}
+
+		/// <summary>
+		/// Seeded (processSeed) version of hash; for tables keyed by outside input (HashDoS). Equal
+		/// keys / lookups still hash the same within the process.
+		/// </summary>
+		template<typename T>
+		static size_t seededHash(const T& key)
+		{
+			if constexpr (std::convertible_to<const T&, const char*>)
+			{
+				const char* chars = key;
+
+				return hashGenerator::generateBytesHash(chars, (chars == nullptr) ? 0 : std::strlen(chars), processSeed());
+			}
+			else if constexpr (requires { { key.getHash(size_t()) } -> std::convertible_to<size_t>; })
+				return key.getHash(processSeed());
+
+			else
+				return hashGenerator::generateSeededHash(processSeed(), key);
+		}
+
+		/// <summary>
+		/// Random seed - created once per process - for use with the seeded hash functions
+		/// </summary>
+		static size_t processSeed()
+		{
+			static const size_t seed = createRandomSeed();
+			return seed;
+		}
+
+	private:
+
+		static size_t createRandomSeed()
+		{
+			std::random_device device;
+
+			uint64_t seed = ((uint64_t)device() << 32) ^ (uint64_t)device();
+
+			return (size_t)simpleWyHash::mix(seed, (uint64_t)&device);
+		}
+	};
+
+	template<isHashable K, typename V>
+	class simpleHashCore;
+
+	/// <summary>
+	/// Backend (policy) for simpleHash. The core is stored inline in the simpleHash; so calls
+	/// against a concrete (final) core are bound statically and may be inlined.
+	/// </summary>
+	template<typename TCore, typename K, typename V>
+	concept isHashCore = std::derived_from<TCore, simpleHashCore<K, V>> && std::default_initializable<TCore>;
+
 	template<isHashable K, typename V>
 	class simpleHashCore : public simpleObject
 	{
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleHashCore.h"
+#include "simpleHashBasicCore.h"
+#include "simpleHashStdCore.h"
+#include "simplePair.h"
+
+namespace simple
+{
+	/// <summary>
+	/// Backend choice for the type-erased simpleHash core (simpleHashDynamicCore)
+	/// </summary>
+	enum class simpleHashBackend : int
+	{
+		Basic = 0,
+		Std = 1
+	};
+
+	/// <summary>
+	/// Type-erased simpleHash core:  the backend is chosen at runtime; and every call goes through the
+	/// simpleHashCore vtable. Use simpleHash<K, V, simpleHashDynamicCore<K, V>> where the backend is
+	/// not known at compile time; otherwise prefer a concrete core.
+	/// </summary>
+	template<isHashable K, typename V>
+	class simpleHashDynamicCore final : public simpleHashCore<K, V>
+	{
+	public:
+
+		simpleHashDynamicCore();
+		simpleHashDynamicCore(simpleHashBackend backend);
+		simpleHashDynamicCore(const simpleHashDynamicCore<K, V>& copy);
+		~simpleHashDynamicCore();
+
+		void operator=(const simpleHashDynamicCore<K, V>& copy);
+
+		V get(const K& key) const override;
+		void add(const K& key, const V& value) override;
+		void set(const K& key, const V& value) override;
+
+		simplePair<K, V>* getAt(int index) override;
+
+		bool contains(const K& key) const override;
+		int count() const override;
+
+		bool remove(const K& key) override;
+		void clear() override;
+
+		void iterate(const simpleHashCallback<K, V>& callback) const override;
+
+	public:
+
+		simpleHashBackend getBackend() const;
+
+	private:
+
+		static simpleHashCore<K, V>* createCore(simpleHashBackend backend);
+
+	private:
+
+		simpleHashCore<K, V>* _core;
+		simpleHashBackend _backend;
+	};
+
+	template<isHashable K, typename V>
+	simpleHashDynamicCore<K, V>::simpleHashDynamicCore()
+		: simpleHashDynamicCore(simpleHashBackend::Basic)
+	{
+	}
+
+	template<isHashable K, typename V>
+	simpleHashDynamicCore<K, V>::simpleHashDynamicCore(simpleHashBackend backend)
+	{
+		_core = createCore(backend);
+		_backend = backend;
+	}
+
+	template<isHashable K, typename V>
+	simpleHashDynamicCore<K, V>::simpleHashDynamicCore(const simpleHashDynamicCore<K, V>& copy)
+		: simpleHashDynamicCore(copy.getBackend())
+	{
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			_core->add(key, value);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable K, typename V>
+	simpleHashDynamicCore<K, V>::~simpleHashDynamicCore()
+	{
+		delete _core;
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashDynamicCore<K, V>::operator=(const simpleHashDynamicCore<K, V>& copy)
+	{
+		if (this == &copy)
+			return;
+
+		// (MEMORY!) Take the backend of the copy
+		delete _core;
+
+		_core = createCore(copy.getBackend());
+		_backend = copy.getBackend();
+
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			_core->add(key, value);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable K, typename V>
+	simpleHashCore<K, V>* simpleHashDynamicCore<K, V>::createCore(simpleHashBackend backend)
+	{
+		switch (backend)
+		{
+			case simpleHashBackend::Basic:
+				return new simpleHashBasicCore<K, V>();
+			case simpleHashBackend::Std:
+				return new simpleHashStdCore<K, V>();
+			default:
+				throw simpleException("Unhandled simpleHashBackend:  simpleHashDynamicCore.h");
+		}
+	}
+
+	template<isHashable K, typename V>
+	simpleHashBackend simpleHashDynamicCore<K, V>::getBackend() const
+	{
+		return _backend;
+	}
+
+	template<isHashable K, typename V>
+	V simpleHashDynamicCore<K, V>::get(const K& key) const
+	{
+		return _core->get(key);
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashDynamicCore<K, V>::add(const K& key, const V& value)
+	{
+		_core->add(key, value);
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashDynamicCore<K, V>::set(const K& key, const V& value)
+	{
+		_core->set(key, value);
+	}
+
+	template<isHashable K, typename V>
+	simplePair<K, V>* simpleHashDynamicCore<K, V>::getAt(int index)
+	{
+		return _core->getAt(index);
+	}
+
+	template<isHashable K, typename V>
+	bool simpleHashDynamicCore<K, V>::contains(const K& key) const
+	{
+		return _core->contains(key);
+	}
+
+	template<isHashable K, typename V>
+	int simpleHashDynamicCore<K, V>::count() const
+	{
+		return _core->count();
+	}
+
+	template<isHashable K, typename V>
+	bool simpleHashDynamicCore<K, V>::remove(const K& key)
+	{
+		return _core->remove(key);
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashDynamicCore<K, V>::clear()
+	{
+		_core->clear();
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashDynamicCore<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	{
+		_core->iterate(callback);
+	}
+}
@@ -3,21 +3,32 @@
 #include "simple.h"
 #include "simpleHashCore.h"
 #include "simplePair.h"
-#include "simpleList.h"
 
 #include "simpleException.h"
-#include <unordered_map>
+#include <concepts>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 namespace simple
 {
+	/// <summary>
+	/// Core on std::unordered_set (simpleHashBackend::Std). Keys are hashed with the per-process
+	/// seed (see simpleHashStdKey::seededHash); so its bucket layout can't be targeted by the input.
+	/// </summary>
 	template<isHashable K, typename V>
-	class simpleHashStdCore : public simpleHashCore<K, V>
+	class simpleHashStdCore final : public simpleHashCore<K, V>
 	{
 	public:
 
 		simpleHashStdCore();
+		simpleHashStdCore(const simpleHashStdCore<K, V>& copy);
 		~simpleHashStdCore();
 
+		void operator=(const simpleHashStdCore<K, V>& copy);
+
 		V get(const K& key) const override;
 		void add(const K& key, const V& value) override;
 		void set(const K& key, const V& value) override;
@@ -30,134 +41,250 @@ namespace simple
 		bool remove(const K& key) override;
 		void clear() override;
 
+	public:	// Heterogeneous lookup (no K is constructed for the lookup)
+
+		template<isHashLookup<K> TLookup>
+		V get(const TLookup& key) const;
+
+		template<isHashLookup<K> TLookup>
+		bool contains(const TLookup& key) const;
+
 	public:
 
 		void iterate(const simpleHashCallback<K, V>& callback) const override;
 
 	private:
 
-		size_t calculateHashCode(const K& key) const;
+		/// <summary>
+		/// Index into the entry list. The hash set stores these (not the keys); and hashes / compares
+		/// them by reading the key out of the entry list - so each key is stored exactly once.
+		/// </summary>
+		struct entryIndex
+		{
+			int index;
+		};
+
+		using entryList = std::vector<std::optional<simplePair<K, V>>>;
+
+		struct entryHasher
+		{
+			using is_transparent = void;
+
+			const entryList* entries;
+
+			size_t operator()(const entryIndex& entry) const
+			{
+				return simpleHashStdKey::seededHash((*entries)[entry.index]->getKey());
+			}
+
+			template<typename TLookup>
+			size_t operator()(const TLookup& key) const
+			{
+				return simpleHashStdKey::seededHash(key);
+			}
+		};
+
+		struct entryEqual
+		{
+			using is_transparent = void;
+
+			const entryList* entries;
+
+			bool operator()(const entryIndex& entry1, const entryIndex& entry2) const
+			{
+				return (*entries)[entry1.index]->getKey() == (*entries)[entry2.index]->getKey();
+			}
+
+			template<typename TLookup>
+			bool operator()(const TLookup& key, const entryIndex& entry) const
+			{
+				return (*entries)[entry.index]->getKey() == key;
+			}
+
+			template<typename TLookup>
+			bool operator()(const entryIndex& entry, const TLookup& key) const
+			{
+				return (*entries)[entry.index]->getKey() == key;
+			}
+		};
+
+		using entrySet = std::unordered_set<entryIndex, entryHasher, entryEqual>;
+
+	private:
+
+		void copyImpl(const simpleHashStdCore<K, V>& copy);
+		void compact();
+		void rebuildSet();
 
 	private:
 
-		// https://en.cppreference.com/w/cpp/utility/hash
-		// Key comparer:   operator ==
-		// Hash function:  std::hash <-- simpleStruct, simpleObject, hashGenerator
-		// 
-		std::unordered_map<size_t, simplePair<K, V>*>* _map;
+		// Entries in insertion order. Removal leaves an empty slot (O(1)); the list is compacted
+		// once the empty slots outnumber the live entries.
+		entryList _entries;
+
+		// Key -> entry index (https://en.cppreference.com/w/cpp/container/unordered_set/find)
+		entrySet _set;
 
-		// Parallel list (for index retrieval)
-		simpleList<simplePair<K, V>*>* _list;
+		// First live entry index (all slots before it are empty)
+		int _first;
+
+		// Number of empty slots in the entry list
+		int _removedCount;
 	};
 
 	template<isHashable K, typename V>
 	simpleHashStdCore<K, V>::simpleHashStdCore()
+		: _set(0, entryHasher{ &_entries }, entryEqual{ &_entries })
 	{
-		_map = new std::unordered_map<size_t, simplePair<K, V>*>();
-		_list = new simpleList<simplePair<K, V>*>();
+		_first = 0;
+		_removedCount = 0;
+	}
+
+	template<isHashable K, typename V>
+	simpleHashStdCore<K, V>::simpleHashStdCore(const simpleHashStdCore<K, V>& copy)
+		: _set(0, entryHasher{ &_entries }, entryEqual{ &_entries })
+	{
+		_first = 0;
+		_removedCount = 0;
+
+		copyImpl(copy);
 	}
 
 	template<isHashable K, typename V>
 	simpleHashStdCore<K, V>::~simpleHashStdCore()
 	{
-		// Delete the simplePair instances
-		for (std::const_iterator iter = _map->begin(); iter != _map->end(); ++iter)
-		{
-			delete iter->second;
-		}
+		// Entries are stored by value
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashStdCore<K, V>::operator=(const simpleHashStdCore<K, V>& copy)
+	{
+		if (this == &copy)
+			return;
 
-		delete _map;
-		delete _list;
+		copyImpl(copy);
 	}
 
 	template<isHashable K, typename V>
-	size_t simpleHashStdCore<K, V>::calculateHashCode(const K& key) const
+	void simpleHashStdCore<K, V>::copyImpl(const simpleHashStdCore<K, V>& copy)
 	{
-		return hashGenerator::generateHash(key);
+		this->clear();
+
+		copy.iterate([this] (const K& key, const V& value)
+		{
+			this->add(key, value);
+			return iterationCallback::iterate;
+		});
 	}
 
 	template<isHashable K, typename V>
 	V simpleHashStdCore<K, V>::get(const K& key) const
 	{
-		size_t hash = this->calculateHashCode(key);
+		typename entrySet::const_iterator iter = _set.find(key);
 
-		if (!_map->contains(hash))
+		if (iter == _set.end())
 			throw simpleException("Key not found in simpleHash:  simpleHashStdCore::get");
 
-		return _map->at(hash)->getValue();
+		return _entries[iter->index]->getValue();
 	}
 
 	template<isHashable K, typename V>
-	void simpleHashStdCore<K, V>::add(const K& key, const V& value)
+	template<isHashLookup<K> TLookup>
+	V simpleHashStdCore<K, V>::get(const TLookup& key) const
 	{
-		size_t hash = this->calculateHashCode(key);
+		typename entrySet::const_iterator iter = _set.find(key);
 
-		if (_map->contains(hash))
-			throw simpleException("Trying to add duplicate key to simpleHash:  simpleHashStdCore::get");
+		if (iter == _set.end())
+			throw simpleException("Key not found in simpleHash:  simpleHashStdCore::get");
 
-		simplePair<K, V>* pair = new simplePair<K, V>(key, value);
+		return _entries[iter->index]->getValue();
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashStdCore<K, V>::add(const K& key, const V& value)
+	{
+		if (_set.find(key) != _set.end())
+			throw simpleException("Trying to add duplicate key to simpleHash:  simpleHashStdCore::add");
 
-		// (MEMORY!)
-		_map->emplace(hash, pair);
+		_entries.emplace_back(simplePair<K, V>(key, value));
 
-		// Keep a parallel list for index lookup
-		_list->add(pair);
+		_set.insert(entryIndex{ (int)_entries.size() - 1 });
 	}
 
 	template<isHashable K, typename V>
 	void simpleHashStdCore<K, V>::set(const K& key, const V& value)
 	{
-		size_t hash = this->calculateHashCode(key);
+		typename entrySet::const_iterator iter = _set.find(key);
 
-		if (!_map->contains(hash))
+		if (iter == _set.end())
 			throw simpleException("Key not found in simpleHash:  simpleHashStdCore::set");
 
-		_map->at(hash)->set(key, value);
-
-		// Parallel list already has the same pointer to memory
+		_entries[iter->index]->setValue(value);
 	}
 
 	template<isHashable K, typename V>
 	simplePair<K, V>* simpleHashStdCore<K, V>::getAt(int index)
 	{
-		if (index < 0 || index >= _list->count())
-			throw simpleException("Key not found in simpleHash:  simpleHashStdCore::getAt");
+		if (index < 0 || index >= this->count())
+			throw simpleException("Index outside the bounds of the simpleHash:  simpleHashStdCore::getAt");
+
+		// Empty slots in the middle of the list must be removed for direct indexing
+		if (_removedCount > _first)
+			compact();
 
-		return _list->get(index);
+		return &(*_entries[_first + index]);
 	}
 
 	template<isHashable K, typename V>
 	bool simpleHashStdCore<K, V>::contains(const K& key) const
 	{
-		size_t hash = this->calculateHashCode(key);
+		return _set.find(key) != _set.end();
+	}
 
-		return _map->contains(hash);
+	template<isHashable K, typename V>
+	template<isHashLookup<K> TLookup>
+	bool simpleHashStdCore<K, V>::contains(const TLookup& key) const
+	{
+		return _set.find(key) != _set.end();
 	}
 
 	template<isHashable K, typename V>
 	int simpleHashStdCore<K, V>::count() const
 	{
-		return _list->count();
+		return (int)_entries.size() - _removedCount;
 	}
 
 	template<isHashable K, typename V>
 	bool simpleHashStdCore<K, V>::remove(const K& key)
 	{
-		size_t hash = this->calculateHashCode(key);
+		typename entrySet::const_iterator iter = _set.find(key);
+
+		if (iter == _set.end())
+			return false;
 
-		if (!_map->contains(hash))
-			throw simpleException("Key not found in simpleHash:  simpleHashStdCore::remove");
+		int index = iter->index;
 
-		simplePair<K, V>* pair = _map->at(hash);
+		// Erase from the set first (the hasher reads the entry)
+		_set.erase(iter);
 
-		// Remove follower list
-		_list->remove(pair);
+		_entries[index].reset();
+		_removedCount++;
 
-		// "Erase" from the std map
-		int success = _map->erase(hash);
+		// Maintain the first live entry
+		while (_first < (int)_entries.size() && !_entries[_first].has_value())
+			_first++;
 
-		if (success != 1)
-			throw simpleException("std::unordered_map::erase failed to complete successfully:  simpleHashStdCore::remove");
+		// Empty list
+		if (_removedCount == (int)_entries.size())
+		{
+			_entries.clear();
+			_first = 0;
+			_removedCount = 0;
+		}
+
+		// Keep the empty slots bounded
+		else if (_removedCount > 16 && _removedCount > this->count())
+			compact();
 
 		return true;
 	}
@@ -165,31 +292,61 @@ namespace simple
 	template<isHashable K, typename V>
 	void simpleHashStdCore<K, V>::clear()
 	{
-		// Go ahead and call std::unordered_map::clear
-		_map->clear();
+		_set.clear();
+		_entries.clear();
+
+		_first = 0;
+		_removedCount = 0;
+	}
+
+	template<isHashable K, typename V>
+	void simpleHashStdCore<K, V>::compact()
+	{
+		int liveIndex = 0;
 
-		// Now, clear our memory cache
-		for (int index = 0; index < _list->count(); index++)
+		for (int index = 0; index < (int)_entries.size(); index++)
 		{
-			// (MEMORY!) simplePair instances
-			delete _list->get(index);
+			if (!_entries[index].has_value())
+				continue;
+
+			if (liveIndex != index)
+			{
+				_entries[liveIndex].emplace(*_entries[index]);
+				_entries[index].reset();
+			}
+
+			liveIndex++;
 		}
 
-		// Clear our list out
-		_list->clear();
+		_entries.resize(liveIndex);
+
+		_first = 0;
+		_removedCount = 0;
+
+		// Indices have moved
+		rebuildSet();
 	}
 
 	template<isHashable K, typename V>
-	void simpleHashStdCore<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	void simpleHashStdCore<K, V>::rebuildSet()
 	{
-		bool userBreak = false;
+		_set.clear();
+		_set.reserve(_entries.size());
+
+		for (int index = 0; index < (int)_entries.size(); index++)
+			_set.insert(entryIndex{ index });
+	}
 
-		for (int index = 0; index < _list->count() && !userBreak; index++)
+	template<isHashable K, typename V>
+	void simpleHashStdCore<K, V>::iterate(const simpleHashCallback<K, V>& callback) const
+	{
+		for (int index = _first; index < (int)_entries.size(); index++)
 		{
-			simplePair<K, V>* pair = _list->get(index);
+			if (!_entries[index].has_value())
+				continue;
 
-			if (callback(pair->getKey(), pair->getValue()) == iterationCallback::breakAndReturn)
-				userBreak = true;
+			if (callback(_entries[index]->getKey(), _entries[index]->getValue()) == iterationCallback::breakAndReturn)
+				break;
 		}
 	}
-}
\ No newline at end of file
+}
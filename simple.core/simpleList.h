@@ -4,7 +4,12 @@
 #include "simpleArray.h"
 #include "simpleException.h"
 #include "simpleMath.h"
+#include "simpleParallel.h"
+#include "simpleSort.h"
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace simple
 {
@@ -40,15 +45,32 @@ namespace simple
 	template<isHashable T, typename TResult>
 	using simpleListAggregator = std::function<TResult(const TResult& current, const T& item)>;
 
+	/// <summary>
+	/// Combines two partial aggregates (see parallelAggregate)
+	/// </summary>
+	template<typename TResult>
+	using simpleListCombiner = std::function<TResult(const TResult& aggregate1, const TResult& aggregate2)>;
+
 	/// <summary>
 	/// Delegate that is used to compare two items
 	/// </summary>
 	template<isHashable T>
 	using simpleListComparer = std::function<int(const T& item1, const T& item2)>;
 
+	/// <summary>
+	/// List with small-buffer storage:  the first SmallCapacity items are stored inline (no heap
+	/// allocation); and the list moves to heap storage when it overflows.
+	/// </summary>
 	template<isHashable T>
 	class simpleList : public simpleObject
 	{
+	public:
+
+		/// <summary>
+		/// Number of items stored inline before the first heap allocation (~64 bytes of items)
+		/// </summary>
+		static constexpr int SmallCapacity = (sizeof(T) >= 64) ? 1 : (int)(64 / sizeof(T));
+
 	public:
 		simpleList();
 		simpleList(const T* anArray, int arrayLength);
@@ -69,6 +91,11 @@ namespace simple
 		T removeAt(int index);
 		void clear();
 
+		/// <summary>
+		/// Ensures room for (at least) the capacity without further allocation
+		/// </summary>
+		void reserve(int capacity);
+
 	protected:
 
 		int ArrayIncrement = 100;
@@ -114,7 +141,32 @@ namespace simple
 
 		int count(simpleListPredicate<T> predicate) const;
 
-		simpleList<T> sort(simpleListComparer<T> comparer) const;
+		// Sorting:  sort returns a sorted (stable) copy; the others sort the list in place (see simpleSort)
+
+		simpleList<T> sort(const simpleListComparer<T>& comparer) const;
+
+		void sortInPlace(const simpleListComparer<T>& comparer);
+		void stableSort(const simpleListComparer<T>& comparer);
+		void parallelSort(const simpleListComparer<T>& comparer);
+
+		template<isNumber TKey>
+		void radixSort(const simpleListSelector<T, TKey>& keySelector);
+
+		// Parallel (default thread pool; see simpleParallel). Callbacks are called concurrently.
+
+		void parallelForEach(const simpleListCallback<T>& callback) const;
+
+		template<isHashable TResult>
+		simpleList<TResult> parallelSelect(const simpleListSelector<T, TResult>& selector) const;
+
+		simpleList<T> parallelWhere(const simpleListPredicate<T>& predicate) const;
+
+		/// <summary>
+		/// Aggregates chunks of the list in parallel (each from the seed); and combines the chunk
+		/// results in order. The seed must be an identity of the combiner (e.g. 0 for a sum).
+		/// </summary>
+		template<typename TResult>
+		TResult parallelAggregate(const TResult& seed, const simpleListAggregator<T, TResult>& aggregator, const simpleListCombiner<TResult>& combiner) const;
 
 	public:
 
@@ -123,73 +175,88 @@ namespace simple
 	private:
 
 		void reAllocate();
+		void reAllocate(int newCapacity);
 		bool compare(const simpleList<T>& other);
 
+		bool isSmall() const;
+
 	private:
 
-		simpleArray<T>* _array;
+		// Points to either the inline buffer, or the heap storage
+		T* _array;
 
+		int _capacity;
 		int _count;
+
+		// Inline (uninitialized) storage for the first SmallCapacity items
+		alignas(T) unsigned char _smallBuffer[SmallCapacity * sizeof(T)];
 	};
 
 	template<isHashable T>
 	simpleList<T>::simpleList()
 	{
-		_array = new simpleArray<T>(0);
+		_array = reinterpret_cast<T*>(_smallBuffer);
+		_capacity = SmallCapacity;
 		_count = 0;
 	}
 	template<isHashable T>
 	simpleList<T>::simpleList(const T* anArray, int arrayLength)
+		: simpleList()
 	{
-		_array = new simpleArray<T>(anArray, arrayLength);
-		_count = 0;
+		this->addRange(anArray, arrayLength);
 	}
 
 	template<isHashable T>
 	simpleList<T>::simpleList(const simpleArray<T>& anArray)
+		: simpleList()
 	{
-		_array = new simpleArray<T>(anArray);
-		_count = _array->count();
+		this->addRange(anArray.getArray(), anArray.count());
 	}
 
 	template<isHashable T>
 	simpleList<T>::simpleList(const simpleList<T>& copy)
+		: simpleList()
 	{
-		_array = new simpleArray<T>(copy.count());
-		_count = 0;
-
-		for (int index = 0; index < copy.count(); index++)
-			this->add(copy.get(index));
+		this->addRange(copy);
 	}
 	template<isHashable T>
 	simpleList<T>::~simpleList()
 	{
-		delete _array;
+		std::destroy_n(_array, _count);
+
+		// (MEMORY!) Heap storage only
+		if (!this->isSmall())
+			std::allocator<T>().deallocate(_array, _capacity);
 
 		_array = nullptr;
+		_capacity = 0;
 		_count = 0;
 	}
 
 	template<isHashable T>
 	void simpleList<T>::operator=(const simpleList<T>& other)
 	{
-		delete _array;
+		if (this == &other)
+			return;
 
-		_array = new simpleArray<T>(other.count());
-		_count = _array->count();
+		this->clear();
+		this->addRange(other);
+	}
 
-		for (int index = 0; index < _count; index++)
-			_array->set(index, other.get(index));
+	template<isHashable T>
+	bool simpleList<T>::isSmall() const
+	{
+		return _array == reinterpret_cast<const T*>(_smallBuffer);
 	}
 
 
 	template<isHashable T>
 	T simpleList<T>::get(int index) const
 	{
-		if (index >= _count)
+		if (index < 0 || index >= _count)
 			throw simpleException("Index is outside the bounds of the list:  simpleList.h");
 
-		return _array->get(index);
+		return _array[index];
 	}
 
 	template<isHashable T>
@@ -218,7 +285,10 @@ namespace simple
 	template<isHashable T>
 	void simpleList<T>::set(int index, const T& item)
 	{
-		_array->set(index, item);
+		if (index < 0 || index >= _count)
+			throw simpleException("Index is outside the bounds of the list:  simpleList.h");
+
+		_array[index] = item;
 	}
 
 	template<isHashable T>
@@ -226,16 +296,21 @@ namespace simple
 	{
 		// Reached capacity
 		//
-		if (_count == _array->count())
+		if (_count == _capacity)
 			this->reAllocate();
 
 		// Add the next item
-		_array->set(_count++, item);
+		std::construct_at(_array + _count, item);
+
+		_count++;
 	}
 
 	template<isHashable T>
 	void simpleList<T>::addRange(const T* list, int listLength)
 	{
+		if (_count + listLength > _capacity)
+			this->reAllocate(_count + listLength);
+
 		for (int index = 0; index < listLength; index++)
 			this->add(list[index]);
 	}
@@ -243,6 +318,9 @@ namespace simple
 	template<isHashable T>
 	void simpleList<T>::addRange(const simpleList<T>& list)
 	{
+		if (_count + list.count() > _capacity)
+			this->reAllocate(_count + list.count());
+
 		for (int index = 0; index < list.count(); index++)
 			this->add(list.get(index));
 	}
@@ -250,45 +328,81 @@ namespace simple
 	template<isHashable T>
 	void simpleList<T>::insert(int insertIndex, const T& item)
 	{
+		if (insertIndex < 0 || insertIndex > _count)
+			throw simpleException("Index is outside the bounds of the list:  simpleList::insert");
+
+		if (insertIndex == _count)
+		{
+			this->add(item);
+			return;
+		}
+
 		// Check capacity before using extra "swap space"
-		if (_count == _array->count())
+		if (_count == _capacity)
 			this->reAllocate();
 
-		// Start at back + 1  ->  insertion index
-		for (int index = _count; index >= insertIndex; index--)
+		// Back item moves into the new (uninitialized) slot
+		std::construct_at(_array + _count, _array[_count - 1]);
+
+		// Back - 1  ->  insertion index
+		for (int index = _count - 1; index > insertIndex; index--)
 		{
-			_array->set(index, _array->get(index - 1));
+			_array[index] = _array[index - 1];
 		}
 
 		// Have space for the next item
-		_array->set(insertIndex, item);
+		_array[insertIndex] = item;
 
 		_count++;
 	}
 
+	template<isHashable T>
+	void simpleList<T>::reserve(int capacity)
+	{
+		this->reAllocate(capacity);
+	}
+
 	template<isHashable T>
 	void simpleList<T>::reAllocate()
 	{
-		if (_count != _array->count())
+		if (_count != _capacity)
 			throw simpleException("Trying to re-allocate memory for simple list before capacity is reached");
 
 		// Use doubling method: Always multiply size by 2 until {MaxElementIncrement} is reached
 		//
-		int newSize = (_array->count() == 0) ? 10 : (_array->count() >= this->ArrayIncrement) ?
-			(_array->count() + this->ArrayIncrement) :
-			_array->count() * 2;
+		int newSize = (_capacity >= this->ArrayIncrement) ?
+			(_capacity + this->ArrayIncrement) :
+			simpleMath::maxOf(_capacity * 2, 10);
+
+		this->reAllocate(newSize);
+	}
+
+	template<isHashable T>
+	void simpleList<T>::reAllocate(int newCapacity)
+	{
+		if (newCapacity <= _capacity)
+			return;
 
-		// Copy over the data
-		simpleArray<T>* newArray = new simpleArray<T>(newSize);
+		// (MEMORY!) Uninitialized heap storage
+		T* newArray = std::allocator<T>().allocate(newCapacity);
 
-		for (int index = 0; index < _array->count(); index++)
+		// Move the items over
+		if constexpr (std::is_trivially_copyable_v<T>)
 		{
-			newArray->set(index, _array->get(index));
+			if (_count > 0)
+				std::memcpy((void*)newArray, (const void*)_array, _count * sizeof(T));
+		}
+		else
+		{
+			std::uninitialized_move_n(_array, _count, newArray);
+			std::destroy_n(_array, _count);
 		}
 
-		delete _array;
+		if (!this->isSmall())
+			std::allocator<T>().deallocate(_array, _capacity);
 
 		_array = newArray;
+		_capacity = newCapacity;
 	}
 
 	template<isHashable T>
@@ -314,16 +428,18 @@ namespace simple
 	template<isHashable T>
 	T simpleList<T>::removeAt(int index)
 	{
-		if (index >= _count)
+		if (index < 0 || index >= _count)
 			throw simpleException("Index is outside the bounds of the array");
 
 		T item = this->get(index);
 
 		for (int i = index; i < _count - 1; i++)
 		{
-			_array->set(i, _array->get(i + 1));
+			_array[i] = _array[i + 1];
 		}
 
+		std::destroy_at(_array + _count - 1);
+
 		_count--;
 
 		return item;
@@ -336,7 +452,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			if (item == _array->get(index))
+			if (item == _array[index])
 			{
 				itemIndex = index;
 				break;
@@ -353,8 +469,10 @@ namespace simple
 	template<isHashable T>
 	void simpleList<T>::clear()
 	{
-		// Soft Delete
+		// Soft Delete:  capacity is kept
 		//
+		std::destroy_n(_array, _count);
+
 		_count = 0;
 	}
 
@@ -363,7 +481,7 @@ namespace simple
 	{
 		for (int index = 0; index < _count; index++)
 		{
-			if (_array->get(index) == item)
+			if (_array[index] == item)
 				return true;
 		}
 
@@ -389,7 +507,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			result.add(selector(_array->get(index)));
+			result.add(selector(_array[index]));
 		}
 
 		return result;
@@ -402,9 +520,9 @@ namespace simple
 
 		for (int index = _count - 1; index >= 0; index--)
 		{
-			if (predicate(_array->get(index)))
+			if (predicate(_array[index]))
 			{
-				result.add(_array->get(index));
+				result.add(_array[index]);
 
 				this->removeAt(index);
 			}
@@ -420,8 +538,8 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			if (!predicate(_array->get(index)))
-				result.add(_array->get(index));
+			if (!predicate(_array[index]))
+				result.add(_array[index]);
 		}
 
 		return result;
@@ -432,7 +550,7 @@ namespace simple
 	{
 		for (int index = 0; index < _count; index++)
 		{
-			if (callback(_array->get(index)) == iterationCallback::breakAndReturn)
+			if (callback(_array[index]) == iterationCallback::breakAndReturn)
 				return;
 		}
 	}
@@ -444,10 +562,10 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			if (_array->get(index) != defaultValue)
+			if (_array[index] != defaultValue)
 			{
-				if (predicate(_array->get(index)))
-					return _array->get(index);
+				if (predicate(_array[index]))
+					return _array[index];
 			}
 		}
 	}
@@ -457,8 +575,8 @@ namespace simple
 	{
 		for (int index = 0; index < _count; index++)
 		{
-			if (predicate(_array->get(index)))
-				return _array->get(index);
+			if (predicate(_array[index]))
+				return _array[index];
 		}
 
 		return default_value::value<T>();
@@ -478,7 +596,7 @@ namespace simple
 	{
 		for (int index = 0; index < _count; index++)
 		{
-			if (predicate(_array->get(index)))
+			if (predicate(_array[index]))
 				return true;
 		}
 
@@ -492,83 +610,87 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			if (predicate(_array->get(index)))
-				result.add(_array->get(index));
+			if (predicate(_array[index]))
+				result.add(_array[index]);
 		}
 
 		return result;
 	}
 
 	template<isHashable T>
-	simpleList<T> simpleList<T>::sort(simpleListComparer<T> comparer) const
+	simpleList<T> simpleList<T>::sort(const simpleListComparer<T>& comparer) const
 	{
-		simpleList<T> result;
+		simpleList<T> result(*this);
 
-		// Binary Insert
-		//
-		for (int index = 0; index < this->count(); index++)
-		{
-			/*
-				function binary_search(A, n, T) is
-					L := 0
-					R := n − 1
-					while L ≤ R do
-						m := floor((L + R) / 2)
-						if A[m] < T then
-							L := m + 1
-						else if A[m] > T then
-							R := m − 1
-						else:
-							return m
-					return unsuccessful
-			 */
-
-			int leftIndex = 0;
-			int rightIndex = result.count() - 1;
-
-			// Initialize insert index to be the left index
-			int insertIndex = leftIndex;
-
-			T searchItem = this->get(index);
-
-			while (leftIndex <= rightIndex)
-			{
-				int middleIndex = (int)simpleMath::floor((leftIndex + rightIndex) / 2.0f);
-				T item = result.get(middleIndex);
-
-				// Set insert index
-				insertIndex = middleIndex;
-
-				// Item's value is LESS THAN search value
-				if (comparer(item, searchItem) < 0)
-				{
-					leftIndex = middleIndex + 1;
-
-					// Set insert index for catching final iteration
-					insertIndex = leftIndex;
-				}
-
-				// GREATER THAN
-				else if (comparer(item, searchItem) > 0)
-					rightIndex = middleIndex - 1;
-
-				else
-				{
-					insertIndex = middleIndex;
-					break;
-				}
-			}
+		result.stableSort(comparer);
 
-			if (insertIndex >= 0 && insertIndex < result.count())
-				result.insert(insertIndex, searchItem);
+		return result;
+	}
 
-			else
-				result.add(searchItem);
-		}
+	template<isHashable T>
+	void simpleList<T>::sortInPlace(const simpleListComparer<T>& comparer)
+	{
+		simpleSort::introSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	void simpleList<T>::stableSort(const simpleListComparer<T>& comparer)
+	{
+		simpleSort::stableSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	void simpleList<T>::parallelSort(const simpleListComparer<T>& comparer)
+	{
+		simpleSort::parallelSort(_array, _count, comparer);
+	}
+
+	template<isHashable T>
+	template<isNumber TKey>
+	void simpleList<T>::radixSort(const simpleListSelector<T, TKey>& keySelector)
+	{
+		simpleSort::radixSort<T, TKey>(_array, _count, keySelector);
+	}
+
+	template<isHashable T>
+	void simpleList<T>::parallelForEach(const simpleListCallback<T>& callback) const
+	{
+		simpleParallel::forEach(_array, _count, callback);
+	}
+
+	template<isHashable T>
+	template<isHashable TResult>
+	simpleList<TResult> simpleList<T>::parallelSelect(const simpleListSelector<T, TResult>& selector) const
+	{
+		simpleArray<TResult> result(_count);
+
+		simpleParallel::select(_array, _count, result._array, selector);
+
+		return simpleList<TResult>(result);
+	}
+
+	template<isHashable T>
+	simpleList<T> simpleList<T>::parallelWhere(const simpleListPredicate<T>& predicate) const
+	{
+		std::vector<int> indices = simpleParallel::where(_array, _count, predicate);
+
+		simpleList<T> result;
+
+		result.reserve((int)indices.size());
+
+		for (int index = 0; index < (int)indices.size(); index++)
+			result.add(_array[indices[index]]);
 
 		return result;
 	}
 
+	template<isHashable T>
+	template<typename TResult>
+	TResult simpleList<T>::parallelAggregate(const TResult& seed, const simpleListAggregator<T, TResult>& aggregator, const simpleListCombiner<TResult>& combiner) const
+	{
+		return simpleParallel::aggregate(_array, _count, seed, aggregator, combiner);
+	}
+
 	template<isHashable T>
 	template<typename TResult>
 	TResult simpleList<T>::maxOf(simpleListSelector<T, TResult> selector) const
@@ -578,7 +700,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			TResult current = selector(_array->get(index));
+			TResult current = selector(_array[index]);
 
 			if (max == default_value::value<T>())
 			{
@@ -605,7 +727,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			TResult current = selector(_array->get(index));
+			TResult current = selector(_array[index]);
 
 			if (min == default_value::value<T>())
 			{
@@ -658,7 +780,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			TResult value = selector(_array->get(index));
+			TResult value = selector(_array[index]);
 
 			if (min == default_value::value<TResult>())
 			{
@@ -673,7 +795,7 @@ namespace simple
 			}
 		}
 
-		return min == default_value::value<TResult>() ? default_value::value<T>() : _array->get(minIndex);
+		return min == default_value::value<TResult>() ? default_value::value<T>() : _array[minIndex];
 	}
 
 	template<isHashable T>
@@ -685,7 +807,7 @@ namespace simple
 
 		for (int index = 0; index < _count; index++)
 		{
-			TResult current = selector(_array->get(index));
+			TResult current = selector(_array[index]);
 
 			if (max == default_value::value<TResult>())
 			{
@@ -704,6 +826,6 @@ namespace simple
 			return default_value::value<T>();
 
 		else
-			return _array->get(maxIndex);
+			return _array[maxIndex];
 	}
 }
\ No newline at end of file
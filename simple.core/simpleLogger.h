@@ -3,6 +3,7 @@
 #include "simple.h"
 #include "simpleLogger.h"
 #include "simpleExt.h"
+#include "simpleFormat.h"
 #include <iostream>
 
 namespace simple
@@ -39,13 +40,24 @@ namespace simple
 		static void logColor(const simpleConsoleColor& color, const char* message);
 
 		template <isStringConvertible T, isStringConvertible...Args>
-		static void log(const char* formatStr, const T& param, const Args&... args);
+		static void log(simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+		                const T& param, const Args&... args);
 
 		template <isStringConvertible T, isStringConvertible...Args>
-		static void logColor(const simpleConsoleColor& color, const char* formatStr, const T& param,
-		                     const Args&... args);
+		static void logColor(const simpleConsoleColor& color,
+		                     simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+		                     const T& param, const Args&... args);
 
 	private:
+		/// <summary>
+		/// Log lines are formatted on the stack (longer lines fall back to one allocation)
+		/// </summary>
+		static constexpr int LineBufferSize = 512;
+
+		template <isStringConvertible T, isStringConvertible...Args>
+		static void write(simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+		                  const T& param, const Args&... args);
+
 		static void setColor(simpleConsoleColor textColor);
 	};
 
@@ -62,24 +74,46 @@ namespace simple
 	}
 
 	template <isStringConvertible T, isStringConvertible... Args>
-	void simpleLogger::log(const char* formatStr, const T& param, const Args&... args)
+	void simpleLogger::log(simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+	                       const T& param, const Args&... args)
 	{
-		std::string message = simpleExt::format(formatStr, param, args...);
-
-		std::cout << message << std::endl;
+		write(formatStr, param, args...);
 	}
 
 	template <isStringConvertible T, isStringConvertible... Args>
-	void simpleLogger::logColor(const simpleConsoleColor& color, const char* formatStr, const T& param,
-	                            const Args&... args)
+	void simpleLogger::logColor(const simpleConsoleColor& color,
+	                            simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+	                            const T& param, const Args&... args)
 	{
-		std::string message = simpleExt::format(formatStr, param, args...);
-
 		setColor(color);
-		std::cout << message << std::endl;
+		write(formatStr, param, args...);
 		setColor(simpleConsoleColor::White);
 	}
 
+	template <isStringConvertible T, isStringConvertible... Args>
+	void simpleLogger::write(simpleFormatString<std::type_identity_t<T>, std::type_identity_t<Args>...> formatStr,
+	                         const T& param, const Args&... args)
+	{
+		char buffer[LineBufferSize];
+
+		int length = simpleFormat::formatTo(buffer, LineBufferSize, formatStr, param, args...);
+
+		if (length < LineBufferSize)
+			std::cout.write(buffer, length) << std::endl;
+
+		else
+		{
+			// (MEMORY!)
+			std::string message;
+
+			message.reserve(length);
+
+			simpleFormat::formatTo(message, formatStr, param, args...);
+
+			std::cout << message << std::endl;
+		}
+	}
+
 	void simpleLogger::setColor(simpleConsoleColor textColor)
 	{
 		std::cout << "\033[" << (int)textColor << "m";
@@ -0,0 +1,253 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace simple
+{
+	/*
+		Multiple Producer / Multiple Consumer Queue:  Bounded, lock-free (Vyukov)
+
+		- Each cell carries a sequence number:  sequence == position -> the cell is free for the
+		  producer claiming that position; sequence == position + 1 -> the cell holds the item for
+		  the consumer claiming that position. Producers / consumers claim positions by CAS on the
+		  enqueue / dequeue position; which live on separate cache lines.
+		- Batch operations claim a run of ready cells with a single CAS
+
+		https://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+	*/
+	template<typename T>
+	class simpleMPMCQueue
+	{
+	public:
+
+		simpleMPMCQueue(int capacity);
+		~simpleMPMCQueue();
+
+		simpleMPMCQueue(const simpleMPMCQueue<T>& copy) = delete;
+		void operator=(const simpleMPMCQueue<T>& copy) = delete;
+
+		/// <summary>
+		/// Returns false if the queue is full
+		/// </summary>
+		bool tryEnqueue(const T& item);
+
+		/// <summary>
+		/// Enqueues (in order) as many of the items as there are free cells; and returns that number
+		/// </summary>
+		int tryEnqueueBatch(const T* items, int itemsLength);
+
+		/// <summary>
+		/// Returns false if the queue is empty
+		/// </summary>
+		bool tryDequeue(T& item);
+
+		/// <summary>
+		/// Dequeues (in order) up to maxCount items into the destination; and returns that number
+		/// </summary>
+		int tryDequeueBatch(T* destination, int maxCount);
+
+		/// <summary>
+		/// Approximate number of items (exact when there are no operations in flight)
+		/// </summary>
+		int count() const;
+
+		int capacity() const;
+
+	private:
+
+		struct cell
+		{
+			std::atomic<size_t> sequence;
+
+			alignas(T) unsigned char item[sizeof(T)];
+
+			T* getItem()
+			{
+				return reinterpret_cast<T*>(item);
+			}
+		};
+
+		/// <summary>
+		/// Claims up to maxCount consecutive positions whose cells are ready (sequence == position + offset);
+		/// and returns the first position (claimedCount is zero when none are ready)
+		/// </summary>
+		size_t claim(std::atomic<size_t>& position, size_t offset, int maxCount, int& claimedCount);
+
+	private:
+
+		// Power of two
+		size_t _capacity;
+		size_t _mask;
+
+		cell* _cells;
+
+		alignas(simpleCacheLineSize) std::atomic<size_t> _enqueuePosition;
+		alignas(simpleCacheLineSize) std::atomic<size_t> _dequeuePosition;
+
+		// Pads the dequeue line from anything allocated after the queue
+		char _padding[simpleCacheLineSize - sizeof(std::atomic<size_t>)];
+	};
+
+	template<typename T>
+	simpleMPMCQueue<T>::simpleMPMCQueue(int capacity)
+	{
+		if (capacity < 2)
+			throw simpleException("Invalid capacity (must be at least 2):  simpleMPMCQueue.h");
+
+		_capacity = std::bit_ceil((size_t)capacity);
+		_mask = _capacity - 1;
+
+		// (MEMORY!)
+		_cells = new cell[_capacity];
+
+		for (size_t index = 0; index < _capacity; index++)
+			_cells[index].sequence.store(index, std::memory_order_relaxed);
+
+		_enqueuePosition.store(0, std::memory_order_relaxed);
+		_dequeuePosition.store(0, std::memory_order_relaxed);
+	}
+
+	template<typename T>
+	simpleMPMCQueue<T>::~simpleMPMCQueue()
+	{
+		size_t dequeuePosition = _dequeuePosition.load(std::memory_order_relaxed);
+		size_t enqueuePosition = _enqueuePosition.load(std::memory_order_relaxed);
+
+		for (size_t position = dequeuePosition; position != enqueuePosition; position++)
+			std::destroy_at(_cells[position & _mask].getItem());
+
+		// (MEMORY!)
+		delete[] _cells;
+	}
+
+	template<typename T>
+	size_t simpleMPMCQueue<T>::claim(std::atomic<size_t>& position, size_t offset, int maxCount, int& claimedCount)
+	{
+		size_t first = position.load(std::memory_order_relaxed);
+
+		claimedCount = 0;
+
+		// (Nothing to claim:  A ready cell would otherwise never be taken; and never be "behind")
+		if (maxCount <= 0)
+			return first;
+
+		while (true)
+		{
+			// Count the ready cells from the current position
+			int readyCount = 0;
+
+			while (readyCount < maxCount)
+			{
+				size_t sequence = _cells[(first + readyCount) & _mask].sequence.load(std::memory_order_acquire);
+
+				if (sequence != first + readyCount + offset)
+					break;
+
+				readyCount++;
+			}
+
+			if (readyCount == 0)
+			{
+				size_t sequence = _cells[first & _mask].sequence.load(std::memory_order_acquire);
+
+				// Became ready since it was counted:  Count again
+				if (sequence == first + offset)
+					continue;
+
+				// Behind:  The cell is still in use by the previous lap (full / empty)
+				if ((ptrdiff_t)(sequence - (first + offset)) < 0)
+					return first;
+
+				// Ahead:  Another thread claimed the position; reload
+				first = position.load(std::memory_order_relaxed);
+				continue;
+			}
+
+			// Ready cells can only be taken by moving the position past them
+			if (position.compare_exchange_weak(first, first + readyCount, std::memory_order_relaxed))
+			{
+				claimedCount = readyCount;
+				return first;
+			}
+		}
+	}
+
+	template<typename T>
+	bool simpleMPMCQueue<T>::tryEnqueue(const T& item)
+	{
+		return this->tryEnqueueBatch(&item, 1) == 1;
+	}
+
+	template<typename T>
+	int simpleMPMCQueue<T>::tryEnqueueBatch(const T* items, int itemsLength)
+	{
+		if (itemsLength <= 0)
+			return 0;
+
+		int claimedCount = 0;
+		size_t first = claim(_enqueuePosition, 0, itemsLength, claimedCount);
+
+		for (int index = 0; index < claimedCount; index++)
+		{
+			cell& target = _cells[(first + index) & _mask];
+
+			std::construct_at(target.getItem(), items[index]);
+
+			// Publish to the consumer of this position
+			target.sequence.store(first + index + 1, std::memory_order_release);
+		}
+
+		return claimedCount;
+	}
+
+	template<typename T>
+	bool simpleMPMCQueue<T>::tryDequeue(T& item)
+	{
+		return this->tryDequeueBatch(&item, 1) == 1;
+	}
+
+	template<typename T>
+	int simpleMPMCQueue<T>::tryDequeueBatch(T* destination, int maxCount)
+	{
+		if (maxCount <= 0)
+			return 0;
+
+		int claimedCount = 0;
+		size_t first = claim(_dequeuePosition, 1, maxCount, claimedCount);
+
+		for (int index = 0; index < claimedCount; index++)
+		{
+			cell& source = _cells[(first + index) & _mask];
+
+			destination[index] = std::move(*source.getItem());
+
+			std::destroy_at(source.getItem());
+
+			// Free the cell for the producer of the next lap
+			source.sequence.store(first + index + _capacity, std::memory_order_release);
+		}
+
+		return claimedCount;
+	}
+
+	template<typename T>
+	int simpleMPMCQueue<T>::count() const
+	{
+		size_t dequeuePosition = _dequeuePosition.load(std::memory_order_relaxed);
+		size_t enqueuePosition = _enqueuePosition.load(std::memory_order_relaxed);
+
+		return (enqueuePosition > dequeuePosition) ? (int)(enqueuePosition - dequeuePosition) : 0;
+	}
+
+	template<typename T>
+	int simpleMPMCQueue<T>::capacity() const
+	{
+		return (int)_capacity;
+	}
+}
@@ -0,0 +1,180 @@
+#include "simpleMappedFilePlatform.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace simple
+{
+#ifdef _WIN32
+
+	simpleMappedFileResult simpleMappedFilePlatform::map(const char* filename, simpleMappedFileMode mode, char*& data, size_t& size)
+	{
+		data = nullptr;
+		size = 0;
+
+		DWORD fileAccess = (mode == simpleMappedFileMode::ReadWrite) ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+
+		HANDLE file = CreateFileA(filename, fileAccess, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+			return simpleMappedFileResult::OpenFailed;
+
+		LARGE_INTEGER fileSize;
+
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			CloseHandle(file);
+			return simpleMappedFileResult::SizeFailed;
+		}
+
+		size = (size_t)fileSize.QuadPart;
+
+		// (Empty files can't be mapped)
+		if (size == 0)
+		{
+			CloseHandle(file);
+			return simpleMappedFileResult::Success;
+		}
+
+		DWORD protection = (mode == simpleMappedFileMode::ReadOnly) ? PAGE_READONLY :
+						   (mode == simpleMappedFileMode::ReadWrite) ? PAGE_READWRITE : PAGE_WRITECOPY;
+
+		DWORD viewAccess = (mode == simpleMappedFileMode::ReadOnly) ? FILE_MAP_READ :
+						   (mode == simpleMappedFileMode::ReadWrite) ? FILE_MAP_WRITE : FILE_MAP_COPY;
+
+		HANDLE mapping = CreateFileMappingA(file, nullptr, protection, 0, 0, nullptr);
+
+		if (mapping != nullptr)
+			data = (char*)MapViewOfFile(mapping, viewAccess, 0, 0, 0);
+
+		// The view keeps the mapping (and file) open
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+
+		CloseHandle(file);
+
+		return (data == nullptr) ? simpleMappedFileResult::MapFailed : simpleMappedFileResult::Success;
+	}
+
+	void simpleMappedFilePlatform::unmap(char* data, size_t)
+	{
+		UnmapViewOfFile(data);
+	}
+
+	void simpleMappedFilePlatform::advise(char* data, size_t offset, size_t length, simpleMappedFileAccess access)
+	{
+		if (access == simpleMappedFileAccess::WillNeed)
+		{
+			WIN32_MEMORY_RANGE_ENTRY range;
+
+			range.VirtualAddress = data + offset;
+			range.NumberOfBytes = length;
+
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+	}
+
+	void simpleMappedFilePlatform::flush(char* data, size_t)
+	{
+		FlushViewOfFile(data, 0);
+	}
+
+#else
+
+	simpleMappedFileResult simpleMappedFilePlatform::map(const char* filename, simpleMappedFileMode mode, char*& data, size_t& size)
+	{
+		data = nullptr;
+		size = 0;
+
+		int file = open(filename, (mode == simpleMappedFileMode::ReadWrite) ? O_RDWR : O_RDONLY);
+
+		if (file < 0)
+			return simpleMappedFileResult::OpenFailed;
+
+		struct stat fileStat;
+
+		if (fstat(file, &fileStat) != 0)
+		{
+			close(file);
+			return simpleMappedFileResult::SizeFailed;
+		}
+
+		size = (size_t)fileStat.st_size;
+
+		// (Empty files can't be mapped)
+		if (size == 0)
+		{
+			close(file);
+			return simpleMappedFileResult::Success;
+		}
+
+		int protection = (mode == simpleMappedFileMode::ReadOnly) ? PROT_READ : (PROT_READ | PROT_WRITE);
+		int flags = (mode == simpleMappedFileMode::CopyOnWrite) ? MAP_PRIVATE : MAP_SHARED;
+
+		void* mapping = mmap(nullptr, size, protection, flags, file, 0);
+
+		// The mapping keeps the file open
+		close(file);
+
+		if (mapping == MAP_FAILED)
+			return simpleMappedFileResult::MapFailed;
+
+		data = (char*)mapping;
+
+		return simpleMappedFileResult::Success;
+	}
+
+	void simpleMappedFilePlatform::unmap(char* data, size_t size)
+	{
+		munmap(data, size);
+	}
+
+	void simpleMappedFilePlatform::advise(char* data, size_t offset, size_t length, simpleMappedFileAccess access)
+	{
+		// madvise takes a page aligned address
+		size_t pageSize = (size_t)sysconf(_SC_PAGESIZE);
+		size_t alignedOffset = offset - (offset % pageSize);
+
+		int advice = MADV_NORMAL;
+
+		switch (access)
+		{
+		case simpleMappedFileAccess::Sequential:
+			advice = MADV_SEQUENTIAL;
+			break;
+		case simpleMappedFileAccess::Random:
+			advice = MADV_RANDOM;
+			break;
+		case simpleMappedFileAccess::WillNeed:
+			advice = MADV_WILLNEED;
+			break;
+		case simpleMappedFileAccess::DontNeed:
+			advice = MADV_DONTNEED;
+			break;
+		default:
+			break;
+		}
+
+		// (Hints only:  failure is not an error)
+		madvise(data + alignedOffset, length + (offset - alignedOffset), advice);
+	}
+
+	void simpleMappedFilePlatform::flush(char* data, size_t size)
+	{
+		msync(data, size, MS_SYNC);
+	}
+
+#endif
+}
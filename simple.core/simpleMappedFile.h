@@ -0,0 +1,148 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleBuffer.h"
+#include "simpleException.h"
+#include "simpleExt.h"
+#include "simpleMappedFilePlatform.h"
+#include "simpleString.h"
+#include "simpleStringView.h"
+#include <climits>
+#include <cstddef>
+
+namespace simple
+{
+	/*
+		Mapped File:  Maps a file into memory (mmap / MapViewOfFile)
+
+		- Opening is O(1):  nothing is read until a page is touched; and read-only pages are shared
+		  with every other process that maps the file (page cache)
+		- getBuffer() / getView() are views over the mapping (no copy); valid while the mapped file
+		  is alive. The buffer of a read-only mapping must not be written.
+		- advise(...) passes access pattern hints (sequential scans; random access; prefetch)
+		- The platform calls are behind simpleMappedFilePlatform (simpleMappedFile.cpp); so windows.h /
+		  mman.h are not included by this header
+	*/
+	class simpleMappedFile
+	{
+	public:
+
+		simpleMappedFile(const char* filename, simpleMappedFileMode mode = simpleMappedFileMode::ReadOnly);
+		simpleMappedFile(const simpleString& filename, simpleMappedFileMode mode = simpleMappedFileMode::ReadOnly);
+		~simpleMappedFile();
+
+		simpleMappedFile(const simpleMappedFile& copy) = delete;
+		void operator=(const simpleMappedFile& copy) = delete;
+
+		/// <summary>
+		/// Start of the mapping (nullptr for an empty file)
+		/// </summary>
+		char* getData() const;
+		size_t getSize() const;
+
+		simpleMappedFileMode getMode() const;
+
+		/// <summary>
+		/// Buffer view over the mapping (does not own the memory). The pages of a ReadOnly mapping
+		/// can't be written:  encode* on its buffer faults. Use CopyOnWrite for private writes.
+		/// </summary>
+		simpleBuffer getBuffer(bool checkWordAlignment = false) const;
+
+		/// <summary>
+		/// Text view over the mapping (files under 2 GB)
+		/// </summary>
+		simpleStringView getView() const;
+
+		/// <summary>
+		/// Access hint for [offset, offset + length); length 0 is the rest of the file
+		/// </summary>
+		void advise(simpleMappedFileAccess access, size_t offset = 0, size_t length = 0);
+
+		/// <summary>
+		/// Writes modified pages to the file (ReadWrite)
+		/// </summary>
+		void flush();
+
+	private:
+
+		char* _data;
+		size_t _size;
+
+		simpleMappedFileMode _mode;
+	};
+
+	inline simpleMappedFile::simpleMappedFile(const char* filename, simpleMappedFileMode mode)
+	{
+		_data = nullptr;
+		_size = 0;
+		_mode = mode;
+
+		switch (simpleMappedFilePlatform::map(filename, mode, _data, _size))
+		{
+		case simpleMappedFileResult::OpenFailed:
+			throw simpleException(simpleExt::format("Error trying to open file:  {}", filename));
+		case simpleMappedFileResult::SizeFailed:
+			throw simpleException(simpleExt::format("Error trying to read file size:  {}", filename));
+		case simpleMappedFileResult::MapFailed:
+			throw simpleException(simpleExt::format("Error trying to map file:  {}", filename));
+		default:
+			break;
+		}
+	}
+
+	inline simpleMappedFile::simpleMappedFile(const simpleString& filename, simpleMappedFileMode mode)
+		: simpleMappedFile(filename.c_str(), mode)
+	{
+	}
+
+	inline simpleMappedFile::~simpleMappedFile()
+	{
+		if (_data != nullptr)
+			simpleMappedFilePlatform::unmap(_data, _size);
+	}
+
+	inline void simpleMappedFile::advise(simpleMappedFileAccess access, size_t offset, size_t length)
+	{
+		if (_data == nullptr || offset >= _size)
+			return;
+
+		if (length == 0 || length > _size - offset)
+			length = _size - offset;
+
+		simpleMappedFilePlatform::advise(_data, offset, length, access);
+	}
+
+	inline void simpleMappedFile::flush()
+	{
+		if (_data != nullptr && _mode == simpleMappedFileMode::ReadWrite)
+			simpleMappedFilePlatform::flush(_data, _size);
+	}
+
+	inline char* simpleMappedFile::getData() const
+	{
+		return _data;
+	}
+
+	inline size_t simpleMappedFile::getSize() const
+	{
+		return _size;
+	}
+
+	inline simpleMappedFileMode simpleMappedFile::getMode() const
+	{
+		return _mode;
+	}
+
+	inline simpleBuffer simpleMappedFile::getBuffer(bool checkWordAlignment) const
+	{
+		return simpleBuffer(_data, _size, checkWordAlignment);
+	}
+
+	inline simpleStringView simpleMappedFile::getView() const
+	{
+		if (_size > (size_t)INT_MAX)
+			throw simpleException("File is too large for a view:  simpleMappedFile::getView");
+
+		return simpleStringView(_data, (int)_size);
+	}
+}
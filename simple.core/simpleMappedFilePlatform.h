@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+
+namespace simple
+{
+	enum class simpleMappedFileMode : int
+	{
+		/// <summary>
+		/// Pages are shared (read only)
+		/// </summary>
+		ReadOnly = 0,
+
+		/// <summary>
+		/// Writes go to the file (shared with other mappings of it)
+		/// </summary>
+		ReadWrite = 1,
+
+		/// <summary>
+		/// Writes are private to this mapping (the file is not changed)
+		/// </summary>
+		CopyOnWrite = 2
+	};
+
+	/// <summary>
+	/// Access pattern hints for the OS (madvise). On Windows only WillNeed has an effect (prefetch).
+	/// </summary>
+	enum class simpleMappedFileAccess : int
+	{
+		Normal = 0,
+		Sequential = 1,
+		Random = 2,
+		WillNeed = 3,
+		DontNeed = 4
+	};
+
+	enum class simpleMappedFileResult : int
+	{
+		Success = 0,
+		OpenFailed = 1,
+		SizeFailed = 2,
+		MapFailed = 3
+	};
+
+	/// <summary>
+	/// OS calls for simpleMappedFile (mmap / MapViewOfFile):  defined in simpleMappedFile.cpp; so
+	/// the platform headers stay out of the headers. (No exceptions:  simpleMappedFile throws)
+	/// </summary>
+	class simpleMappedFilePlatform
+	{
+	public:
+
+		/// <summary>
+		/// Maps the whole file. An empty file succeeds with a nullptr mapping (size 0).
+		/// </summary>
+		static simpleMappedFileResult map(const char* filename, simpleMappedFileMode mode, char*& data, size_t& size);
+
+		static void unmap(char* data, size_t size);
+
+		/// <summary>
+		/// Access hint for [data + offset, data + offset + length) (within the mapping)
+		/// </summary>
+		static void advise(char* data, size_t offset, size_t length, simpleMappedFileAccess access);
+
+		static void flush(char* data, size_t size);
+	};
+}
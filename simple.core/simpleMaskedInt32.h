@@ -3,10 +3,11 @@
 #include "simple.h"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace simple
 {
-	struct simpleMaskedInt32 : simpleStruct
+	struct simpleMaskedInt32
 	{
 		simpleMaskedInt32()
 		{
@@ -20,18 +21,6 @@ namespace simple
 			mask = amask;
 			bitShiftLeft = abitShiftLeft;
 		}
-		simpleMaskedInt32(const simpleMaskedInt32& copy)
-		{
-			value = copy.value;
-			mask = copy.mask;
-			bitShiftLeft = copy.bitShiftLeft;
-		}
-		void operator=(const simpleMaskedInt32& copy)
-		{
-			value = copy.value;
-			mask = copy.mask;
-			bitShiftLeft = copy.bitShiftLeft;
-		}
 
 		/// <summary>
 		/// Applies the mask and bit shift to resolve the masked int
@@ -55,7 +44,7 @@ namespace simple
 			return bitShiftLeft;
 		}
 
-		size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(value, mask, bitShiftLeft);
 		}
@@ -67,4 +56,6 @@ namespace simple
 		int32_t bitShiftLeft;
 
 	};
+
+	static_assert(std::is_trivially_copyable_v<simpleMaskedInt32>, "simpleMaskedInt32 must remain trivially copyable");
 }
\ No newline at end of file
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleArray.h"
+#include "simpleException.h"
+#include "simpleExt.h"
+#include "simpleList.h"
+#include "simpleStringView.h"
+#include <charconv>
+#include <cstring>
+#include <system_error>
+
+namespace simple
+{
+	/*
+		Number:  Allocation-free parsing / formatting of numbers over character ranges
+
+		- Parsing uses std::from_chars (locale independent; no null terminator needed). The whole view
+		  must be a number (surrounding white space and a leading '+' are allowed); and out-of-range
+		  values fail instead of wrapping.
+		- Formatting uses std::to_chars. Floating point values are written in the shortest form that
+		  parses back to the same value (round-trip).
+		- Delimited parsing reads the numbers straight out of the text (no token copies); and reports
+		  the index of the first character that is not a number.
+	*/
+	class simpleNumber
+	{
+	public:
+
+		/// <summary>
+		/// Buffer size that fits any formatted number
+		/// </summary>
+		static constexpr int MaxFormatLength = 64;
+
+	public:
+
+		/// <summary>
+		/// Parses the (whole) view; and returns false if it is not a number of type T
+		/// </summary>
+		template<isNumber T>
+		static bool tryParse(const simpleStringView& text, T& result)
+		{
+			simpleStringView trimmed = text.trim();
+
+			const char* first = trimmed.getChars();
+			const char* last = first + trimmed.count();
+
+			return parseAt(first, last, result) == last;
+		}
+
+		/// <summary>
+		/// Parses the (whole) view; and throws if it is not a number of type T
+		/// </summary>
+		template<isNumber T>
+		static T parse(const simpleStringView& text)
+		{
+			T result;
+
+			if (!tryParse(text, result))
+				throw simpleException("Invalid number format:  simpleNumber::parse");
+
+			return result;
+		}
+
+		/// <summary>
+		/// Writes the number into the buffer (not null terminated); and returns the number of characters
+		/// </summary>
+		template<isNumber T>
+		static int format(T value, char* buffer, int bufferLength)
+		{
+			std::to_chars_result result = std::to_chars(buffer, buffer + bufferLength, value);
+
+			if (result.ec != std::errc())
+				throw simpleException("Buffer too small for number:  simpleNumber::format");
+
+			return (int)(result.ptr - buffer);
+		}
+
+		/// <summary>
+		/// Parses every number in the text, separated by any of the delimiter characters (e.g. " ,\t\r\n"
+		/// for rows of columns), into the (cleared) list in order. Returns false on the first field that
+		/// is not a number; and sets the error index to its position in the text.
+		/// </summary>
+		template<isNumber T>
+		static bool tryParseDelimited(const simpleStringView& text, const char* delimiters, simpleList<T>& result, int& errorIndex)
+		{
+			if (delimiters == nullptr)
+				throw simpleException("Trying to parse with nullptr delimiters:  simpleNumber::tryParseDelimited");
+
+			// Delimiter lookup (by unsigned character)
+			bool isDelimiter[256];
+
+			std::memset(isDelimiter, 0, sizeof(isDelimiter));
+
+			for (const char* delimiter = delimiters; *delimiter != '\0'; delimiter++)
+				isDelimiter[(unsigned char)*delimiter] = true;
+
+			const char* chars = text.getChars();
+			const char* current = chars;
+			const char* last = chars + text.count();
+
+			result.clear();
+			errorIndex = -1;
+
+			while (true)
+			{
+				// Skip delimiters (empty fields)
+				while (current < last && isDelimiter[(unsigned char)*current])
+					current++;
+
+				if (current >= last)
+					return true;
+
+				T value;
+
+				const char* end = parseAt(current, last, value);
+
+				// Field must end at a delimiter (or the end of the text)
+				if (end == nullptr || (end < last && !isDelimiter[(unsigned char)*end]))
+				{
+					errorIndex = (int)(current - chars);
+					return false;
+				}
+
+				result.add(value);
+
+				current = end;
+			}
+		}
+
+		/// <summary>
+		/// Parses every number in the text (see tryParseDelimited); and throws with the position of
+		/// the first field that is not a number
+		/// </summary>
+		template<isNumber T>
+		static simpleArray<T> parseDelimited(const simpleStringView& text, const char* delimiters)
+		{
+			simpleList<T> result;
+			int errorIndex;
+
+			if (!tryParseDelimited(text, delimiters, result, errorIndex))
+				throw simpleException(simpleExt::format("Invalid number format at index {}:  simpleNumber::parseDelimited", errorIndex));
+
+			return result.toArray();
+		}
+
+	private:
+
+		/// <summary>
+		/// Parses the number at the start of [first, last) (a leading '+' is allowed); and returns the
+		/// end of it, or nullptr on failure
+		/// </summary>
+		template<isNumber T>
+		static const char* parseAt(const char* first, const char* last, T& result)
+		{
+			// std::from_chars does not take a '+' sign
+			if (first < last && *first == '+' && (first + 1 == last || first[1] != '-'))
+				first++;
+
+			std::from_chars_result parsed;
+
+			if constexpr (isFloatLike<T>)
+				parsed = std::from_chars(first, last, result, std::chars_format::general);
+			else
+				parsed = std::from_chars(first, last, result);
+
+			if (parsed.ec != std::errc())
+				return nullptr;
+
+			return parsed.ptr;
+		}
+	};
+}
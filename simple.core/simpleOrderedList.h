@@ -5,6 +5,8 @@
 #include "simpleException.h"
 #include "simpleList.h"
 #include "simpleMath.h"
+#include <algorithm>
+#include <vector>
 
 namespace simple
 {
@@ -32,6 +34,11 @@ namespace simple
 		bool contains(const T& item) const;
 		void forEach(const simpleListCallback<T>& callback) const;
 		simpleList<T> where(const simpleListPredicate<T>& predicate) const;
+
+		/// <summary>
+		/// Adds the collection in O(n + m log m):  the incoming items are sorted; and then merged with
+		/// the existing (sorted) items in a single pass.
+		/// </summary>
 		void addRange(const simpleArray<T>& collection);
 
 	protected:
@@ -131,10 +138,49 @@ namespace simple
 	template<isHashable T>
 	void simpleOrderedList<T>::addRange(const simpleArray<T>& collection)
 	{
-		for (int index = 0; index < collection.count(); index++)
+		if (collection.count() == 0)
+			return;
+
+		const simpleListComparer<T>& comparer = *_comparer;
+
+		// Sort the incoming batch (stable:  equal items keep their order)
+		std::vector<T> batch(collection.getArray(), collection.getArray() + collection.count());
+
+		std::stable_sort(batch.begin(), batch.end(), [&comparer] (const T& item1, const T& item2)
 		{
-			this->add(collection.get(index));
+			return comparer(item1, item2) < 0;
+		});
+
+		// Merge:  existing items go first for equal items
+		std::vector<T> merged;
+		merged.reserve(_list->count() + batch.size());
+
+		int listIndex = 0;
+		size_t batchIndex = 0;
+
+		while (listIndex < _list->count() && batchIndex < batch.size())
+		{
+			T item = _list->get(listIndex);
+
+			if (comparer(batch[batchIndex], item) < 0)
+				merged.push_back(batch[batchIndex++]);
+
+			else
+			{
+				merged.push_back(item);
+				listIndex++;
+			}
 		}
+
+		for (; listIndex < _list->count(); listIndex++)
+			merged.push_back(_list->get(listIndex));
+
+		for (; batchIndex < batch.size(); batchIndex++)
+			merged.push_back(batch[batchIndex]);
+
+		// Replace the list contents (one allocation)
+		_list->clear();
+		_list->addRange(merged.data(), (int)merged.size());
 	}
 
 	template<isHashable T>
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleThreadPool.h"
+#include <atomic>
+#include <vector>
+
+namespace simple
+{
+	/*
+		Parallel Loops:  Data-parallel operations over contiguous storage (used by simpleArray / simpleList)
+
+		The items are split into chunks (see simpleThreadPool::getChunkCount); and the chunks run on the
+		default thread pool. Small inputs run as a single chunk on the calling thread. Callbacks are
+		called concurrently - they must be safe to call from several threads at once.
+	*/
+	class simpleParallel
+	{
+	public:
+
+		/// <summary>
+		/// Calls the callback for each item (in no particular order). Returning breakAndReturn stops
+		/// items that have not been started.
+		/// </summary>
+		template<typename T, typename TCallback>
+		static void forEach(const T* items, int count, const TCallback& callback)
+		{
+			std::atomic<bool> stopped = false;
+
+			simpleThreadPool::getDefault().parallelFor(count, [items, &callback, &stopped] (int, int lowIndex, int highIndex)
+			{
+				for (int index = lowIndex; index < highIndex && !stopped.load(std::memory_order_relaxed); index++)
+				{
+					if (callback(items[index]) == iterationCallback::breakAndReturn)
+						stopped.store(true, std::memory_order_relaxed);
+				}
+			});
+		}
+
+		/// <summary>
+		/// results[i] = selector(items[i]) (the results must already be constructed)
+		/// </summary>
+		template<typename T, typename TResult, typename TSelector>
+		static void select(const T* items, int count, TResult* results, const TSelector& selector)
+		{
+			simpleThreadPool::getDefault().parallelFor(count, [items, results, &selector] (int, int lowIndex, int highIndex)
+			{
+				for (int index = lowIndex; index < highIndex; index++)
+					results[index] = selector(items[index]);
+			});
+		}
+
+		/// <summary>
+		/// Returns the indices (in order) of the items that satisfy the predicate
+		/// </summary>
+		template<typename T, typename TPredicate>
+		static std::vector<int> where(const T* items, int count, const TPredicate& predicate)
+		{
+			simpleThreadPool& pool = simpleThreadPool::getDefault();
+
+			int chunkCount = pool.getChunkCount(count);
+
+			std::vector<std::vector<int>> chunkIndices(chunkCount);
+
+			pool.parallelFor(count, chunkCount, [items, &predicate, &chunkIndices] (int chunkIndex, int lowIndex, int highIndex)
+			{
+				for (int index = lowIndex; index < highIndex; index++)
+				{
+					if (predicate(items[index]))
+						chunkIndices[chunkIndex].push_back(index);
+				}
+			});
+
+			// Chunks are in index order
+			std::vector<int> result;
+
+			for (int chunkIndex = 0; chunkIndex < chunkCount; chunkIndex++)
+				result.insert(result.end(), chunkIndices[chunkIndex].begin(), chunkIndices[chunkIndex].end());
+
+			return result;
+		}
+
+		/// <summary>
+		/// Aggregates each chunk from the seed; and then combines the chunk results (in order). The
+		/// seed must be an identity of the combiner (e.g. 0 for a sum); and the combiner associative.
+		/// </summary>
+		template<typename T, typename TResult, typename TAggregator, typename TCombiner>
+		static TResult aggregate(const T* items, int count, const TResult& seed, const TAggregator& aggregator, const TCombiner& combiner)
+		{
+			simpleThreadPool& pool = simpleThreadPool::getDefault();
+
+			int chunkCount = pool.getChunkCount(count);
+
+			// One cache line per chunk:  No false sharing; and no packed std::vector<bool> (whose
+			//							 neighboring elements share a word)
+			struct alignas(simpleCacheLineSize) chunkResult
+			{
+				TResult value;
+			};
+
+			std::vector<chunkResult> chunkResults(chunkCount, chunkResult{ seed });
+
+			pool.parallelFor(count, chunkCount, [items, &aggregator, &chunkResults] (int chunkIndex, int lowIndex, int highIndex)
+			{
+				TResult result = chunkResults[chunkIndex].value;
+
+				for (int index = lowIndex; index < highIndex; index++)
+					result = aggregator(result, items[index]);
+
+				chunkResults[chunkIndex].value = result;
+			});
+
+			TResult result = chunkResults[0].value;
+
+			for (int chunkIndex = 1; chunkIndex < chunkCount; chunkIndex++)
+				result = combiner(result, chunkResults[chunkIndex].value);
+
+			return result;
+		}
+	};
+}
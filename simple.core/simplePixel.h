@@ -4,10 +4,11 @@
 #include "simpleException.h"
 #include "simpleMaskedInt32.h"
 #include <cstdint>
+#include <type_traits>
 
 namespace simple
 {
-	struct simplePixel : simpleStruct
+	struct simplePixel
 	{
 		enum colorChannel
 		{
@@ -33,22 +34,6 @@ namespace simple
 			alpha = a;
 			maxValue = amaxValue;
 		}
-		simplePixel(const simplePixel& copy)
-		{
-			red = copy.red;
-			green = copy.green;
-			blue = copy.blue;
-			alpha = copy.alpha;
-			maxValue = copy.maxValue;
-		}
-		void operator=(const simplePixel& copy)
-		{
-			red = copy.red;
-			green = copy.green;
-			blue = copy.blue;
-			alpha = copy.alpha;
-			maxValue = copy.maxValue;
-		}
 
 		/// <summary>
 		/// Returns normalized red channel (0, 1)
@@ -108,7 +93,7 @@ namespace simple
 			return maxValue;
 		}
 
-		size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(red, green, blue, alpha, maxValue);
 		}
@@ -122,4 +107,6 @@ namespace simple
 
 		int32_t maxValue;
 	};
+
+	static_assert(std::is_trivially_copyable_v<simplePixel>, "simplePixel must remain trivially copyable");
 }
\ No newline at end of file
@@ -1,27 +1,56 @@
 #pragma once
 
 #include "simple.h"
+#include "simpleException.h"
 #include "simpleList.h"
+#include <bit>
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace simple
 {
 	template<isHashable T>
 	using simpleQueueIterator = std::function<iterationCallback(const T& item)>;
 
+	/// <summary>
+	/// FIFO queue on a growable circular buffer:  enqueue / dequeue are O(1) (amortized). The
+	/// capacity is kept at a power of two; so the wrap-around is a mask (not a modulus).
+	/// </summary>
 	template<isHashable T>
 	class simpleQueue : public simpleObject
 	{
 	public:
-		
+
 		simpleQueue();
+		simpleQueue(int capacity);
 		simpleQueue(const simpleQueue<T>& copy);
 		~simpleQueue();
 
+		void operator=(const simpleQueue<T>& copy);
+
 		void enqueue(const T& item);
-		T dequeue() const;
+		void enqueueRange(const T* items, int itemsLength);
+		void enqueueRange(const simpleList<T>& items);
+
+		T dequeue();
+		bool tryDequeue(T& item);
+
+		/// <summary>
+		/// Dequeues up to maxCount items (in order) onto the end of the destination list. Returns
+		/// the number of items dequeued.
+		/// </summary>
+		int dequeueBatch(simpleList<T>& destination, int maxCount);
 
-		void count() const;
+		T peek() const;
+
+		int count() const;
+		void clear();
+
+		/// <summary>
+		/// Ensures room for (at least) the capacity without further allocation
+		/// </summary>
+		void reserve(int capacity);
 
 	public:
 
@@ -29,65 +58,264 @@ namespace simple
 
 	public:
 
-		void forEach(simpleQueueIterator<T> callback);
+		void forEach(simpleQueueIterator<T> callback) const;
 
 	private:
 
-		simpleList<T>* _list;
+		void reAllocate(int minCapacity);
+
+	private:
+
+		// Circular buffer (uninitialized outside of the live items)
+		T* _array;
+
+		// Power of two (or zero)
+		int _capacity;
+
+		// Index of the front item
+		int _head;
+
+		int _count;
 	};
 
 	template<isHashable T>
 	simpleQueue<T>::simpleQueue()
 	{
-		_list = new simpleList<T>();
+		_array = nullptr;
+		_capacity = 0;
+		_head = 0;
+		_count = 0;
 	}
 
 	template<isHashable T>
-	simpleQueue<T>::simpleQueue(const simpleQueue<T>& copy)
+	simpleQueue<T>::simpleQueue(int capacity)
+		: simpleQueue()
 	{
-		_list = new simpleList<T>();
+		this->reserve(capacity);
+	}
 
-		simpleList<T>* list = _list;
+	template<isHashable T>
+	simpleQueue<T>::simpleQueue(const simpleQueue<T>& copy)
+		: simpleQueue()
+	{
+		this->reserve(copy.count());
 
-		copy.forEach([&list] (T item)
+		copy.forEach([this] (const T& item)
 		{
-			list->add(item);
+			this->enqueue(item);
+			return iterationCallback::iterate;
 		});
 	}
-	
+
 	template<isHashable T>
 	simpleQueue<T>::~simpleQueue()
 	{
-		delete _list;
+		this->clear();
+
+		// (MEMORY!)
+		if (_array != nullptr)
+			std::allocator<T>().deallocate(_array, _capacity);
+
+		_array = nullptr;
+		_capacity = 0;
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::operator=(const simpleQueue<T>& copy)
+	{
+		if (this == &copy)
+			return;
+
+		this->clear();
+		this->reserve(copy.count());
+
+		copy.forEach([this] (const T& item)
+		{
+			this->enqueue(item);
+			return iterationCallback::iterate;
+		});
 	}
 
 	template<isHashable T>
 	void simpleQueue<T>::enqueue(const T& item)
 	{
-		_list->add(item);
+		if (_count == _capacity)
+			this->reAllocate(_count + 1);
+
+		std::construct_at(_array + ((_head + _count) & (_capacity - 1)), item);
+
+		_count++;
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::enqueueRange(const T* items, int itemsLength)
+	{
+		if (itemsLength < 0)
+			throw simpleException("Invalid items length:  simpleQueue::enqueueRange");
+
+		if (_count + itemsLength > _capacity)
+			this->reAllocate(_count + itemsLength);
+
+		for (int index = 0; index < itemsLength; index++)
+			std::construct_at(_array + ((_head + _count + index) & (_capacity - 1)), items[index]);
+
+		_count += itemsLength;
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::enqueueRange(const simpleList<T>& items)
+	{
+		if (_count + items.count() > _capacity)
+			this->reAllocate(_count + items.count());
+
+		items.forEach([this] (const T& item)
+		{
+			this->enqueue(item);
+			return iterationCallback::iterate;
+		});
+	}
+
+	template<isHashable T>
+	T simpleQueue<T>::dequeue()
+	{
+		if (_count == 0)
+			throw simpleException("Trying to dequeue from an empty queue:  simpleQueue::dequeue");
+
+		T item = std::move(_array[_head]);
+
+		std::destroy_at(_array + _head);
+
+		_head = (_head + 1) & (_capacity - 1);
+		_count--;
+
+		return item;
+	}
+
+	template<isHashable T>
+	bool simpleQueue<T>::tryDequeue(T& item)
+	{
+		if (_count == 0)
+			return false;
+
+		item = std::move(_array[_head]);
+
+		std::destroy_at(_array + _head);
+
+		_head = (_head + 1) & (_capacity - 1);
+		_count--;
+
+		return true;
 	}
 
 	template<isHashable T>
-	T simpleQueue<T>::dequeue() const
+	int simpleQueue<T>::dequeueBatch(simpleList<T>& destination, int maxCount)
 	{
-		return _list->removeAt(0);
+		if (maxCount <= 0)
+			return 0;
+
+		int batchCount = simpleMath::minOf(maxCount, _count);
+
+		destination.reserve(destination.count() + batchCount);
+
+		for (int index = 0; index < batchCount; index++)
+		{
+			destination.add(_array[_head]);
+
+			std::destroy_at(_array + _head);
+
+			_head = (_head + 1) & (_capacity - 1);
+		}
+
+		_count -= batchCount;
+
+		return batchCount;
 	}
 
 	template<isHashable T>
-	void simpleQueue<T>::count() const
+	T simpleQueue<T>::peek() const
 	{
-		return _list->count();
+		if (_count == 0)
+			throw simpleException("Trying to peek an empty queue:  simpleQueue::peek");
+
+		return _array[_head];
+	}
+
+	template<isHashable T>
+	int simpleQueue<T>::count() const
+	{
+		return _count;
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::clear()
+	{
+		// Soft Delete:  capacity is kept
+		for (int index = 0; index < _count; index++)
+			std::destroy_at(_array + ((_head + index) & (_capacity - 1)));
+
+		_head = 0;
+		_count = 0;
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::reserve(int capacity)
+	{
+		if (capacity > _capacity)
+			this->reAllocate(capacity);
+	}
+
+	template<isHashable T>
+	void simpleQueue<T>::reAllocate(int minCapacity)
+	{
+		// Doubling (power of two)
+		int newCapacity = (int)std::bit_ceil((unsigned int)simpleMath::maxOf(minCapacity, _capacity * 2, 8));
+
+		// (MEMORY!) Uninitialized storage
+		T* newArray = std::allocator<T>().allocate(newCapacity);
+
+		// Unwrap the items to the front of the new buffer
+		for (int index = 0; index < _count; index++)
+		{
+			T* item = _array + ((_head + index) & (_capacity - 1));
+
+			std::construct_at(newArray + index, std::move(*item));
+			std::destroy_at(item);
+		}
+
+		if (_array != nullptr)
+			std::allocator<T>().deallocate(_array, _capacity);
+
+		_array = newArray;
+		_capacity = newCapacity;
+		_head = 0;
 	}
 
 	template<isHashable T>
 	size_t simpleQueue<T>::getHash() const
 	{
-		return _list->getHash();
+		size_t hash = 0;
+
+		for (int index = 0; index < _count; index++)
+		{
+			const T& item = _array[(_head + index) & (_capacity - 1)];
+
+			if (hash == 0)
+				hash = hashGenerator::generateHash(item);
+
+			else
+				hash = hashGenerator::combineHash(hash, item);
+		}
+
+		return hash;
 	}
 
 	template<isHashable T>
-	void simpleQueue<T>::forEach(simpleQueueIterator<T> callback)
+	void simpleQueue<T>::forEach(simpleQueueIterator<T> callback) const
 	{
-		_list->forEach(callback);
+		for (int index = 0; index < _count; index++)
+		{
+			if (callback(_array[(_head + index) & (_capacity - 1)]) == iterationCallback::breakAndReturn)
+				return;
+		}
 	}
-}
\ No newline at end of file
+}
@@ -0,0 +1,478 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include "simpleString.h"
+#include <cstdint>
+#include <cstring>
+
+namespace simple
+{
+	/*
+		Rope:  Text stored as a balanced tree of fragments (for large, edit-heavy text)
+
+		- The tree is an implicit treap:  fragments are ordered by position (in-order); and balanced by
+		  random priorities (expected depth O(log n)). Each node keeps the length of its subtree, so
+		  positions are found by descending the tree.
+		- insert / remove / replace / get are O(log n) (expected); instead of O(n) for a simpleString.
+		  Small inserts are written into the fragment at the position when it has room.
+		- toString() / subString() copy the fragments out in order
+
+		https://en.wikipedia.org/wiki/Rope_(data_structure)
+	*/
+	class simpleRope
+	{
+	public:
+
+		/// <summary>
+		/// Capacity of one fragment (characters)
+		/// </summary>
+		static constexpr int FragmentSize = 512;
+
+	public:
+
+		simpleRope();
+		simpleRope(const char* chars);
+		simpleRope(const simpleString& text);
+		simpleRope(const simpleRope& copy);
+		~simpleRope();
+
+		void operator=(const simpleRope& copy);
+
+		int count() const;
+		char get(int index) const;
+
+		void append(const simpleString& text);
+		void append(const char* chars, int length);
+
+		void insert(int index, const simpleString& text);
+		void insert(int index, const char* chars, int length);
+
+		void remove(int index, int count);
+
+		/// <summary>
+		/// Replaces the characters [index, index + count) with the text
+		/// </summary>
+		void replace(int index, int count, const simpleString& text);
+
+		void clear();
+
+		simpleString subString(int index, int count) const;
+		simpleString toString() const;
+
+	private:
+
+		struct node
+		{
+			node* left;
+			node* right;
+
+			uint32_t priority;
+
+			// Characters in this subtree
+			int length;
+
+			// (MEMORY!) FragmentSize characters
+			char* fragment;
+			int fragmentLength;
+		};
+
+		node* createNode(const char* chars, int length, uint32_t priority);
+		node* cloneNode(const node* source);
+		void deleteNode(node* target);
+
+		static int lengthOf(const node* target);
+		static void update(node* target);
+
+		/// <summary>
+		/// Splits the tree into the first position characters (left); and the rest (right). A
+		/// fragment that spans the position is cut in two.
+		/// </summary>
+		void split(node* target, int position, node*& left, node*& right);
+
+		/// <summary>
+		/// Joins two trees (all of left is before all of right)
+		/// </summary>
+		node* merge(node* left, node* right);
+
+		/// <summary>
+		/// Inserts into the fragment at the position; if it has room. Returns false otherwise.
+		/// </summary>
+		bool insertInPlace(node* target, int position, const char* chars, int length);
+
+		void copyRange(const node* target, int index, int count, simpleString& destination) const;
+
+		uint32_t nextPriority();
+
+	private:
+
+		node* _root;
+
+		// xorshift32 state
+		uint32_t _seed;
+	};
+
+	inline simpleRope::simpleRope()
+	{
+		_root = nullptr;
+		_seed = 0x9E3779B9;
+	}
+
+	inline simpleRope::simpleRope(const char* chars)
+		: simpleRope()
+	{
+		if (chars == nullptr)
+			throw simpleException("Trying to declare simpleRope from nullptr:  simpleRope.h");
+
+		this->append(chars, (int)strlen(chars));
+	}
+
+	inline simpleRope::simpleRope(const simpleString& text)
+		: simpleRope()
+	{
+		this->append(text);
+	}
+
+	inline simpleRope::simpleRope(const simpleRope& copy)
+		: simpleRope()
+	{
+		_root = this->cloneNode(copy._root);
+	}
+
+	inline simpleRope::~simpleRope()
+	{
+		this->clear();
+	}
+
+	inline void simpleRope::operator=(const simpleRope& copy)
+	{
+		if (this == &copy)
+			return;
+
+		this->clear();
+
+		_root = this->cloneNode(copy._root);
+	}
+
+	inline uint32_t simpleRope::nextPriority()
+	{
+		_seed ^= _seed << 13;
+		_seed ^= _seed >> 17;
+		_seed ^= _seed << 5;
+
+		return _seed;
+	}
+
+	inline simpleRope::node* simpleRope::createNode(const char* chars, int length, uint32_t priority)
+	{
+		// (MEMORY!)
+		node* result = new node();
+
+		result->left = nullptr;
+		result->right = nullptr;
+		result->priority = priority;
+		result->fragment = new char[FragmentSize];
+		result->fragmentLength = length;
+		result->length = length;
+
+		std::memcpy(result->fragment, chars, length);
+
+		return result;
+	}
+
+	inline simpleRope::node* simpleRope::cloneNode(const node* source)
+	{
+		if (source == nullptr)
+			return nullptr;
+
+		node* result = this->createNode(source->fragment, source->fragmentLength, source->priority);
+
+		result->left = this->cloneNode(source->left);
+		result->right = this->cloneNode(source->right);
+		result->length = source->length;
+
+		return result;
+	}
+
+	inline void simpleRope::deleteNode(node* target)
+	{
+		if (target == nullptr)
+			return;
+
+		this->deleteNode(target->left);
+		this->deleteNode(target->right);
+
+		// (MEMORY!)
+		delete[] target->fragment;
+		delete target;
+	}
+
+	inline int simpleRope::lengthOf(const node* target)
+	{
+		return (target == nullptr) ? 0 : target->length;
+	}
+
+	inline void simpleRope::update(node* target)
+	{
+		target->length = lengthOf(target->left) + target->fragmentLength + lengthOf(target->right);
+	}
+
+	inline void simpleRope::split(node* target, int position, node*& left, node*& right)
+	{
+		if (target == nullptr)
+		{
+			left = nullptr;
+			right = nullptr;
+			return;
+		}
+
+		int leftLength = lengthOf(target->left);
+
+		// Position is in the left subtree
+		if (position <= leftLength)
+		{
+			this->split(target->left, position, left, target->left);
+
+			update(target);
+			right = target;
+		}
+
+		// Position is in the right subtree
+		else if (position >= leftLength + target->fragmentLength)
+		{
+			this->split(target->right, position - leftLength - target->fragmentLength, target->right, right);
+
+			update(target);
+			left = target;
+		}
+
+		// Position is inside the fragment:  The tail becomes the root of the right tree (same priority
+		// keeps the heap order over the right subtree it takes)
+		else
+		{
+			int offset = position - leftLength;
+
+			node* tail = this->createNode(target->fragment + offset, target->fragmentLength - offset, target->priority);
+
+			tail->right = target->right;
+			target->right = nullptr;
+			target->fragmentLength = offset;
+
+			update(tail);
+			update(target);
+
+			left = target;
+			right = tail;
+		}
+	}
+
+	inline simpleRope::node* simpleRope::merge(node* left, node* right)
+	{
+		if (left == nullptr)
+			return right;
+
+		if (right == nullptr)
+			return left;
+
+		if (left->priority >= right->priority)
+		{
+			left->right = this->merge(left->right, right);
+
+			update(left);
+			return left;
+		}
+		else
+		{
+			right->left = this->merge(left, right->left);
+
+			update(right);
+			return right;
+		}
+	}
+
+	inline bool simpleRope::insertInPlace(node* target, int position, const char* chars, int length)
+	{
+		if (target == nullptr)
+			return false;
+
+		int leftLength = lengthOf(target->left);
+		bool result = false;
+
+		if (position < leftLength)
+			result = this->insertInPlace(target->left, position, chars, length);
+
+		else if (position > leftLength + target->fragmentLength)
+			result = this->insertInPlace(target->right, position - leftLength - target->fragmentLength, chars, length);
+
+		else if (target->fragmentLength + length <= FragmentSize)
+		{
+			int offset = position - leftLength;
+
+			std::memmove(target->fragment + offset + length, target->fragment + offset, target->fragmentLength - offset);
+			std::memcpy(target->fragment + offset, chars, length);
+
+			target->fragmentLength += length;
+			result = true;
+		}
+
+		// Subtree lengths on the path
+		if (result)
+			target->length += length;
+
+		return result;
+	}
+
+	inline int simpleRope::count() const
+	{
+		return lengthOf(_root);
+	}
+
+	inline char simpleRope::get(int index) const
+	{
+		if (index < 0 || index >= this->count())
+			throw simpleException("Index outside the bounds of the rope:  simpleRope::get");
+
+		const node* target = _root;
+
+		while (true)
+		{
+			int leftLength = lengthOf(target->left);
+
+			if (index < leftLength)
+				target = target->left;
+
+			else if (index < leftLength + target->fragmentLength)
+				return target->fragment[index - leftLength];
+
+			else
+			{
+				index -= leftLength + target->fragmentLength;
+				target = target->right;
+			}
+		}
+	}
+
+	inline void simpleRope::append(const simpleString& text)
+	{
+		this->insert(this->count(), text.c_str(), text.count());
+	}
+
+	inline void simpleRope::append(const char* chars, int length)
+	{
+		this->insert(this->count(), chars, length);
+	}
+
+	inline void simpleRope::insert(int index, const simpleString& text)
+	{
+		this->insert(index, text.c_str(), text.count());
+	}
+
+	inline void simpleRope::insert(int index, const char* chars, int length)
+	{
+		if (index < 0 || index > this->count())
+			throw simpleException("Index for insert was outside the bounds of the rope:  simpleRope::insert");
+
+		if (length <= 0)
+			return;
+
+		if (this->insertInPlace(_root, index, chars, length))
+			return;
+
+		node* left = nullptr;
+		node* right = nullptr;
+
+		this->split(_root, index, left, right);
+
+		// New fragments (full, except for the last)
+		for (int offset = 0; offset < length; offset += FragmentSize)
+		{
+			int fragmentLength = simpleMath::minOf(length - offset, (int)FragmentSize);
+
+			left = this->merge(left, this->createNode(chars + offset, fragmentLength, this->nextPriority()));
+		}
+
+		_root = this->merge(left, right);
+	}
+
+	inline void simpleRope::remove(int index, int count)
+	{
+		if (index < 0 || count < 0 || index + count > this->count())
+			throw simpleException("Index for remove was outside the bounds of the rope:  simpleRope::remove");
+
+		if (count == 0)
+			return;
+
+		node* left = nullptr;
+		node* middle = nullptr;
+		node* right = nullptr;
+
+		this->split(_root, index, left, right);
+		this->split(right, count, middle, right);
+
+		this->deleteNode(middle);
+
+		_root = this->merge(left, right);
+	}
+
+	inline void simpleRope::replace(int index, int count, const simpleString& text)
+	{
+		this->remove(index, count);
+		this->insert(index, text);
+	}
+
+	inline void simpleRope::clear()
+	{
+		this->deleteNode(_root);
+
+		_root = nullptr;
+	}
+
+	inline void simpleRope::copyRange(const node* target, int index, int count, simpleString& destination) const
+	{
+		if (target == nullptr || count <= 0)
+			return;
+
+		int leftLength = lengthOf(target->left);
+
+		// Left subtree:  [0, leftLength)
+		if (index < leftLength)
+			this->copyRange(target->left, index, simpleMath::minOf(count, leftLength - index), destination);
+
+		// Fragment:  [leftLength, leftLength + fragmentLength)
+		int lowIndex = simpleMath::maxOf(index, leftLength);
+		int highIndex = simpleMath::minOf(index + count, leftLength + target->fragmentLength);
+
+		if (lowIndex < highIndex)
+			destination.append(target->fragment + lowIndex - leftLength, highIndex - lowIndex);
+
+		// Right subtree
+		int rightIndex = leftLength + target->fragmentLength;
+
+		if (index + count > rightIndex)
+		{
+			int rightStart = simpleMath::maxOf(index - rightIndex, 0);
+
+			this->copyRange(target->right, rightStart, index + count - rightIndex - rightStart, destination);
+		}
+	}
+
+	inline simpleString simpleRope::subString(int index, int count) const
+	{
+		if (index < 0 || count < 0 || index + count > this->count())
+			throw simpleException("Index outside the bounds of the rope:  simpleRope::subString");
+
+		simpleString result;
+
+		result.reserve(count);
+
+		this->copyRange(_root, index, count, result);
+
+		return result;
+	}
+
+	inline simpleString simpleRope::toString() const
+	{
+		return this->subString(0, this->count());
+	}
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <utility>
+
+namespace simple
+{
+	/*
+		Single Producer / Single Consumer Queue:  Bounded, wait-free ring buffer
+
+		- Exactly one thread may enqueue; and exactly one (other) thread may dequeue
+		- The head (consumer) and tail (producer) indices are on separate cache lines; and each side
+		  keeps a cached copy of the other side's index - so the shared index is only read when the
+		  queue looks full (producer) or empty (consumer).
+		- Batch operations publish the whole batch with a single (release) store
+
+		https://rigtorp.se/ringbuffer/
+	*/
+	template<typename T>
+	class simpleSPSCQueue
+	{
+	public:
+
+		simpleSPSCQueue(int capacity);
+		~simpleSPSCQueue();
+
+		simpleSPSCQueue(const simpleSPSCQueue<T>& copy) = delete;
+		void operator=(const simpleSPSCQueue<T>& copy) = delete;
+
+		/// <summary>
+		/// (Producer) Returns false if the queue is full
+		/// </summary>
+		bool tryEnqueue(const T& item);
+
+		/// <summary>
+		/// (Producer) Enqueues as many of the items as fit; and returns that number
+		/// </summary>
+		int tryEnqueueBatch(const T* items, int itemsLength);
+
+		/// <summary>
+		/// (Consumer) Returns false if the queue is empty
+		/// </summary>
+		bool tryDequeue(T& item);
+
+		/// <summary>
+		/// (Consumer) Dequeues up to maxCount items into the destination; and returns that number
+		/// </summary>
+		int tryDequeueBatch(T* destination, int maxCount);
+
+		/// <summary>
+		/// Number of items at the time of the call (may be stale when read by a third thread)
+		/// </summary>
+		int count() const;
+
+		int capacity() const;
+
+	private:
+
+		// Power of two
+		size_t _capacity;
+		size_t _mask;
+
+		// Uninitialized slots (outside of [head, tail))
+		T* _array;
+
+		// Consumer:  Next index to dequeue; and its cached copy of the tail
+		alignas(simpleCacheLineSize) std::atomic<size_t> _head;
+		size_t _tailCache;
+
+		// Producer:  Next index to enqueue; and its cached copy of the head
+		alignas(simpleCacheLineSize) std::atomic<size_t> _tail;
+		size_t _headCache;
+
+		// Pads the producer line from anything allocated after the queue
+		char _padding[simpleCacheLineSize - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+	};
+
+	template<typename T>
+	simpleSPSCQueue<T>::simpleSPSCQueue(int capacity)
+	{
+		if (capacity <= 0)
+			throw simpleException("Invalid capacity:  simpleSPSCQueue.h");
+
+		_capacity = std::bit_ceil((size_t)capacity);
+		_mask = _capacity - 1;
+
+		// (MEMORY!) Uninitialized storage
+		_array = std::allocator<T>().allocate(_capacity);
+
+		_head.store(0, std::memory_order_relaxed);
+		_tail.store(0, std::memory_order_relaxed);
+		_headCache = 0;
+		_tailCache = 0;
+	}
+
+	template<typename T>
+	simpleSPSCQueue<T>::~simpleSPSCQueue()
+	{
+		size_t head = _head.load(std::memory_order_relaxed);
+		size_t tail = _tail.load(std::memory_order_relaxed);
+
+		for (size_t index = head; index != tail; index++)
+			std::destroy_at(_array + (index & _mask));
+
+		// (MEMORY!)
+		std::allocator<T>().deallocate(_array, _capacity);
+	}
+
+	template<typename T>
+	bool simpleSPSCQueue<T>::tryEnqueue(const T& item)
+	{
+		size_t tail = _tail.load(std::memory_order_relaxed);
+
+		// Looks full:  Refresh the head
+		if (tail - _headCache == _capacity)
+		{
+			_headCache = _head.load(std::memory_order_acquire);
+
+			if (tail - _headCache == _capacity)
+				return false;
+		}
+
+		std::construct_at(_array + (tail & _mask), item);
+
+		_tail.store(tail + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T>
+	int simpleSPSCQueue<T>::tryEnqueueBatch(const T* items, int itemsLength)
+	{
+		if (itemsLength <= 0)
+			return 0;
+
+		size_t tail = _tail.load(std::memory_order_relaxed);
+
+		if (_capacity - (tail - _headCache) < (size_t)itemsLength)
+			_headCache = _head.load(std::memory_order_acquire);
+
+		int batchCount = (int)simpleMath::minOf(_capacity - (tail - _headCache), (size_t)itemsLength);
+
+		for (int index = 0; index < batchCount; index++)
+			std::construct_at(_array + ((tail + index) & _mask), items[index]);
+
+		if (batchCount > 0)
+			_tail.store(tail + batchCount, std::memory_order_release);
+
+		return batchCount;
+	}
+
+	template<typename T>
+	bool simpleSPSCQueue<T>::tryDequeue(T& item)
+	{
+		size_t head = _head.load(std::memory_order_relaxed);
+
+		// Looks empty:  Refresh the tail
+		if (head == _tailCache)
+		{
+			_tailCache = _tail.load(std::memory_order_acquire);
+
+			if (head == _tailCache)
+				return false;
+		}
+
+		T* slot = _array + (head & _mask);
+
+		item = std::move(*slot);
+
+		std::destroy_at(slot);
+
+		_head.store(head + 1, std::memory_order_release);
+
+		return true;
+	}
+
+	template<typename T>
+	int simpleSPSCQueue<T>::tryDequeueBatch(T* destination, int maxCount)
+	{
+		if (maxCount <= 0)
+			return 0;
+
+		size_t head = _head.load(std::memory_order_relaxed);
+
+		if (_tailCache - head < (size_t)maxCount)
+			_tailCache = _tail.load(std::memory_order_acquire);
+
+		int batchCount = (int)simpleMath::minOf(_tailCache - head, (size_t)maxCount);
+
+		for (int index = 0; index < batchCount; index++)
+		{
+			T* slot = _array + ((head + index) & _mask);
+
+			destination[index] = std::move(*slot);
+
+			std::destroy_at(slot);
+		}
+
+		if (batchCount > 0)
+			_head.store(head + batchCount, std::memory_order_release);
+
+		return batchCount;
+	}
+
+	template<typename T>
+	int simpleSPSCQueue<T>::count() const
+	{
+		size_t head = _head.load(std::memory_order_acquire);
+		size_t tail = _tail.load(std::memory_order_acquire);
+
+		return (int)(tail - head);
+	}
+
+	template<typename T>
+	int simpleSPSCQueue<T>::capacity() const
+	{
+		return (int)_capacity;
+	}
+}
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include "simpleThreadPool.h"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace simple
+{
+	/*
+		Sort Engine:  In-place sorting over contiguous storage (used by simpleArray / simpleList)
+
+		- introSort:	Quick sort (median-of-three) -> heap sort past 2 log2(n) depth -> insertion sort
+						for small partitions. O(n log n) worst case; not stable.
+						https://en.wikipedia.org/wiki/Introsort
+
+		- stableSort:	Bottom-up merge sort with one n-sized buffer (insertion sorted runs of 32). Stable.
+						https://en.wikipedia.org/wiki/Merge_sort
+
+		- radixSort:	LSD radix sort (8-bit digits) on a number key taken from each item. Stable; O(n * sizeof(key)).
+						Signed / floating point keys are mapped to order-preserving unsigned keys.
+						https://en.wikipedia.org/wiki/Radix_sort
+
+		- parallelSort: Stable sort of equal chunks on the thread pool; then parallel merges of the chunks.
+
+		Comparers follow the simpleListComparer / simpleArrayComparer convention:  (item1, item2) -> int
+		(< 0 less, 0 equal, > 0 greater); and are template parameters - so lambdas are called directly.
+	*/
+	class simpleSort
+	{
+	public:
+
+		/// <summary>
+		/// Inputs smaller than this are sorted on the calling thread
+		/// </summary>
+		static constexpr int ParallelThreshold = 1 << 16;
+
+	public:
+
+		template<typename T, typename TComparer>
+		static void introSort(T* items, int count, const TComparer& comparer)
+		{
+			if (count < 2)
+				return;
+
+			introSortImpl(items, 0, count - 1, 2 * std::bit_width((unsigned int)count), comparer);
+		}
+
+		template<typename T, typename TComparer>
+		static void stableSort(T* items, int count, const TComparer& comparer)
+		{
+			if (count < 2)
+				return;
+
+			if (count <= InsertionThreshold)
+			{
+				insertionSort(items, 0, count - 1, comparer);
+				return;
+			}
+
+			std::vector<T> buffer(items, items + count);
+
+			stableSortImpl(items, buffer.data(), count, comparer);
+		}
+
+		/// <summary>
+		/// Stable LSD radix sort using a number key for each item (the selector is called once per item)
+		/// </summary>
+		template<typename T, isNumber TKey, typename TKeySelector>
+		static void radixSort(T* items, int count, const TKeySelector& keySelector)
+		{
+			using TRadix = std::conditional_t<sizeof(TKey) <= 4, uint32_t, uint64_t>;
+
+			if (count < 2)
+				return;
+
+			std::vector<TRadix> keys(count);
+			std::vector<TRadix> keyBuffer(count);
+			std::vector<T> buffer(items, items + count);
+
+			for (int index = 0; index < count; index++)
+				keys[index] = toRadixKey<TKey, TRadix>(keySelector(items[index]));
+
+			T* source = items;
+			T* destination = buffer.data();
+			TRadix* sourceKeys = keys.data();
+			TRadix* destinationKeys = keyBuffer.data();
+
+			for (int shift = 0; shift < (int)(sizeof(TRadix) * 8); shift += 8)
+			{
+				int counts[256] = { 0 };
+
+				for (int index = 0; index < count; index++)
+					counts[(sourceKeys[index] >> shift) & 0xFF]++;
+
+				// All keys share this digit:  Nothing to do for the pass
+				if (counts[(sourceKeys[0] >> shift) & 0xFF] == count)
+					continue;
+
+				// Prefix sum -> starting offset of each digit
+				int offset = 0;
+
+				for (int digit = 0; digit < 256; digit++)
+				{
+					int digitCount = counts[digit];
+					counts[digit] = offset;
+					offset += digitCount;
+				}
+
+				for (int index = 0; index < count; index++)
+				{
+					int position = counts[(sourceKeys[index] >> shift) & 0xFF]++;
+
+					destination[position] = std::move(source[index]);
+					destinationKeys[position] = sourceKeys[index];
+				}
+
+				std::swap(source, destination);
+				std::swap(sourceKeys, destinationKeys);
+			}
+
+			// Result ended in the buffer
+			if (source != items)
+			{
+				for (int index = 0; index < count; index++)
+					items[index] = std::move(source[index]);
+			}
+		}
+
+		/// <summary>
+		/// Stable sort on the default thread pool for large inputs (falls back to stableSort)
+		/// </summary>
+		template<typename T, typename TComparer>
+		static void parallelSort(T* items, int count, const TComparer& comparer)
+		{
+			simpleThreadPool& pool = simpleThreadPool::getDefault();
+
+			int chunkCount = pool.getWorkerCount() + 1;
+
+			if (count < ParallelThreshold || chunkCount < 2)
+			{
+				stableSort(items, count, comparer);
+				return;
+			}
+
+			// Chunk boundaries (as simpleThreadPool::parallelFor):  chunk[i] = [bounds[i], bounds[i + 1])
+			std::vector<int> bounds(chunkCount + 1);
+
+			for (int index = 0; index <= chunkCount; index++)
+				bounds[index] = (int)(((long long)count * index) / chunkCount);
+
+			std::vector<T> buffer(items, items + count);
+
+			// Sort Chunks
+			pool.parallelFor(count, chunkCount, [items, &buffer, &comparer] (int, int lowIndex, int highIndex)
+			{
+				int chunkSize = highIndex - lowIndex;
+
+				if (chunkSize <= InsertionThreshold)
+					insertionSort(items + lowIndex, 0, chunkSize - 1, comparer);
+				else
+					stableSortImpl(items + lowIndex, buffer.data() + lowIndex, chunkSize, comparer);
+			});
+
+			// Merge Chunks:  Pairs are merged in parallel (source / destination swap each level)
+			T* source = items;
+			T* destination = buffer.data();
+
+			for (int width = 1; width < chunkCount; width *= 2)
+			{
+				int pairCount = (chunkCount + 2 * width - 1) / (2 * width);
+
+				// One "chunk" per pair of runs
+				pool.parallelFor(pairCount, pairCount, [source, destination, &bounds, &comparer, width, chunkCount] (int pairIndex, int, int)
+				{
+					int left = pairIndex * 2 * width;
+
+					int low = bounds[left];
+					int middle = bounds[simpleMath::minOf(left + width, chunkCount)];
+					int high = bounds[simpleMath::minOf(left + 2 * width, chunkCount)];
+
+					merge(source, destination, low, middle, high, comparer);
+				});
+
+				std::swap(source, destination);
+			}
+
+			if (source != items)
+			{
+				for (int index = 0; index < count; index++)
+					items[index] = std::move(source[index]);
+			}
+		}
+
+	private:
+
+		static constexpr int InsertionThreshold = 32;
+
+		template<isNumber TKey, typename TRadix>
+		static TRadix toRadixKey(TKey key)
+		{
+			constexpr TRadix signBit = TRadix(1) << (sizeof(TKey) * 8 - 1);
+
+			if constexpr (isFloatLike<TKey>)
+			{
+				// IEEE-754:  Negative -> flip all bits; Positive -> flip the sign bit
+				using TBits = std::conditional_t<sizeof(TKey) == 4, uint32_t, uint64_t>;
+
+				TRadix bits = (TRadix)std::bit_cast<TBits>(key);
+
+				return (bits & signBit) ? (TRadix)~bits : (bits | signBit);
+			}
+			else if constexpr (std::is_signed_v<TKey>)
+			{
+				// Two's complement:  Flip the sign bit (of the key width)
+				using TUnsigned = std::make_unsigned_t<TKey>;
+
+				return (TRadix)(TUnsigned)key ^ signBit;
+			}
+			else
+				return (TRadix)key;
+		}
+
+		template<typename T, typename TComparer>
+		static void insertionSort(T* items, int lowIndex, int highIndex, const TComparer& comparer)
+		{
+			for (int index = lowIndex + 1; index <= highIndex; index++)
+			{
+				if (!(comparer(items[index], items[index - 1]) < 0))
+					continue;
+
+				T item = std::move(items[index]);
+				int insertIndex = index;
+
+				// Shift larger items right (strictly greater:  stable)
+				while (insertIndex > lowIndex && comparer(item, items[insertIndex - 1]) < 0)
+				{
+					items[insertIndex] = std::move(items[insertIndex - 1]);
+					insertIndex--;
+				}
+
+				items[insertIndex] = std::move(item);
+			}
+		}
+
+		template<typename T, typename TComparer>
+		static void heapSort(T* items, int lowIndex, int highIndex, const TComparer& comparer)
+		{
+			T* heap = items + lowIndex;
+			int count = highIndex - lowIndex + 1;
+
+			for (int index = count / 2 - 1; index >= 0; index--)
+				siftDown(heap, index, count, comparer);
+
+			for (int last = count - 1; last > 0; last--)
+			{
+				std::swap(heap[0], heap[last]);
+				siftDown(heap, 0, last, comparer);
+			}
+		}
+
+		template<typename T, typename TComparer>
+		static void siftDown(T* heap, int index, int count, const TComparer& comparer)
+		{
+			while (true)
+			{
+				int largest = index;
+				int left = 2 * index + 1;
+				int right = left + 1;
+
+				if (left < count && comparer(heap[largest], heap[left]) < 0)
+					largest = left;
+
+				if (right < count && comparer(heap[largest], heap[right]) < 0)
+					largest = right;
+
+				if (largest == index)
+					return;
+
+				std::swap(heap[index], heap[largest]);
+				index = largest;
+			}
+		}
+
+		template<typename T, typename TComparer>
+		static void introSortImpl(T* items, int lowIndex, int highIndex, int depthLimit, const TComparer& comparer)
+		{
+			while (highIndex - lowIndex + 1 > InsertionThreshold)
+			{
+				// Too many bad partitions:  O(n log n) guarantee
+				if (depthLimit-- == 0)
+				{
+					heapSort(items, lowIndex, highIndex, comparer);
+					return;
+				}
+
+				// Median of three -> items[middle] (also leaves sentinels at the low / high index)
+				int middle = lowIndex + (highIndex - lowIndex) / 2;
+
+				if (comparer(items[middle], items[lowIndex]) < 0)
+					std::swap(items[middle], items[lowIndex]);
+
+				if (comparer(items[highIndex], items[lowIndex]) < 0)
+					std::swap(items[highIndex], items[lowIndex]);
+
+				if (comparer(items[highIndex], items[middle]) < 0)
+					std::swap(items[highIndex], items[middle]);
+
+				T pivot = items[middle];
+
+				// Hoare Partition
+				int left = lowIndex;
+				int right = highIndex;
+
+				while (left <= right)
+				{
+					while (comparer(items[left], pivot) < 0)
+						left++;
+
+					while (comparer(pivot, items[right]) < 0)
+						right--;
+
+					if (left <= right)
+					{
+						std::swap(items[left], items[right]);
+						left++;
+						right--;
+					}
+				}
+
+				// Recurse into the smaller side; loop on the larger (O(log n) stack)
+				if (right - lowIndex < highIndex - left)
+				{
+					introSortImpl(items, lowIndex, right, depthLimit, comparer);
+					lowIndex = left;
+				}
+				else
+				{
+					introSortImpl(items, left, highIndex, depthLimit, comparer);
+					highIndex = right;
+				}
+			}
+
+			insertionSort(items, lowIndex, highIndex, comparer);
+		}
+
+		template<typename T, typename TComparer>
+		static void merge(const T* source, T* destination, int lowIndex, int middleIndex, int highIndex, const TComparer& comparer)
+		{
+			int left = lowIndex;
+			int right = middleIndex;
+			int index = lowIndex;
+
+			// Take from the left unless the right is strictly less (stable)
+			while (left < middleIndex && right < highIndex)
+			{
+				if (comparer(source[right], source[left]) < 0)
+					destination[index++] = source[right++];
+				else
+					destination[index++] = source[left++];
+			}
+
+			while (left < middleIndex)
+				destination[index++] = source[left++];
+
+			while (right < highIndex)
+				destination[index++] = source[right++];
+		}
+
+		template<typename T, typename TComparer>
+		static void stableSortImpl(T* items, T* buffer, int count, const TComparer& comparer)
+		{
+			// Runs of InsertionThreshold
+			for (int low = 0; low < count; low += InsertionThreshold)
+				insertionSort(items, low, simpleMath::minOf(low + InsertionThreshold, count) - 1, comparer);
+
+			T* source = items;
+			T* destination = buffer;
+
+			// Bottom-up merge passes (source / destination swap each pass)
+			for (int width = InsertionThreshold; width < count; width *= 2)
+			{
+				for (int low = 0; low < count; low += 2 * width)
+				{
+					int middle = simpleMath::minOf(low + width, count);
+					int high = simpleMath::minOf(low + 2 * width, count);
+
+					merge(source, destination, low, middle, high, comparer);
+				}
+
+				std::swap(source, destination);
+			}
+
+			if (source != items)
+			{
+				for (int index = 0; index < count; index++)
+					items[index] = std::move(source[index]);
+			}
+		}
+	};
+}
@@ -1,62 +1,257 @@
 #pragma once
 
 #include "simple.h"
-#include "simpleList.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace simple
 {
 	template<isHashable T>
-	class simpleStack : simpleObject
+	using simpleStackIterator = std::function<iterationCallback(const T& item)>;
+
+	/// <summary>
+	/// LIFO stack on contiguous storage:  the top of the stack is the end of the buffer; so push / pop
+	/// are O(1) (amortized) and never shift the other items.
+	/// </summary>
+	template<isHashable T>
+	class simpleStack : public simpleObject
 	{
 	public:
 
 		simpleStack();
+		simpleStack(int capacity);
+		simpleStack(const simpleStack<T>& copy);
 		~simpleStack();
 
+		void operator=(const simpleStack<T>& copy);
+
 		void push(const T& item);
 		T pop();
 		T peek() const;
 
+		/// <summary>
+		/// Moves the top item into the (existing) item; and pops it. Returns false for an empty stack.
+		/// </summary>
+		bool popInto(T& item);
+
 		int count() const;
+		void clear();
+
+		/// <summary>
+		/// Ensures room for (at least) the capacity without further allocation
+		/// </summary>
+		void reserve(int capacity);
+
+	public:
+
+		size_t getHash() const override;
+
+	public:
+
+		/// <summary>
+		/// Iterates from the top of the stack to the bottom
+		/// </summary>
+		void forEach(simpleStackIterator<T> callback) const;
 
 	private:
 
-		simpleList<T>* _list;
+		void reAllocate(int minCapacity);
+		void copyImpl(const simpleStack<T>& copy);
+
+	private:
+
+		// Uninitialized past _count
+		T* _array;
+
+		int _capacity;
+		int _count;
 	};
 
 	template<isHashable T>
 	simpleStack<T>::simpleStack()
 	{
-		_list = new simpleList<T>();
+		_array = nullptr;
+		_capacity = 0;
+		_count = 0;
+	}
+
+	template<isHashable T>
+	simpleStack<T>::simpleStack(int capacity)
+		: simpleStack()
+	{
+		this->reserve(capacity);
+	}
+
+	template<isHashable T>
+	simpleStack<T>::simpleStack(const simpleStack<T>& copy)
+		: simpleStack()
+	{
+		this->copyImpl(copy);
 	}
 
 	template<isHashable T>
 	simpleStack<T>::~simpleStack()
 	{
-		delete _list;
+		this->clear();
+
+		// (MEMORY!)
+		if (_array != nullptr)
+			std::allocator<T>().deallocate(_array, _capacity);
+
+		_array = nullptr;
+		_capacity = 0;
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::operator=(const simpleStack<T>& copy)
+	{
+		if (this == &copy)
+			return;
+
+		this->copyImpl(copy);
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::copyImpl(const simpleStack<T>& copy)
+	{
+		this->clear();
+		this->reserve(copy.count());
+
+		// Bottom -> Top
+		for (int index = 0; index < copy.count(); index++)
+			std::construct_at(_array + index, copy._array[index]);
+
+		_count = copy.count();
 	}
 
 	template<isHashable T>
 	void simpleStack<T>::push(const T& item)
 	{
-		_list->insert(0, item);
+		if (_count == _capacity)
+			this->reAllocate(_count + 1);
+
+		std::construct_at(_array + _count, item);
+
+		_count++;
 	}
 
 	template<isHashable T>
 	T simpleStack<T>::pop()
 	{
-		return _list->removeAt(0);
+		if (_count == 0)
+			throw simpleException("Trying to pop from an empty stack:  simpleStack::pop");
+
+		_count--;
+
+		T item = std::move(_array[_count]);
+
+		std::destroy_at(_array + _count);
+
+		return item;
+	}
+
+	template<isHashable T>
+	bool simpleStack<T>::popInto(T& item)
+	{
+		if (_count == 0)
+			return false;
+
+		_count--;
+
+		item = std::move(_array[_count]);
+
+		std::destroy_at(_array + _count);
+
+		return true;
 	}
 
 	template<isHashable T>
 	T simpleStack<T>::peek() const
 	{
-		return _list->get(0);
+		if (_count == 0)
+			throw simpleException("Trying to peek an empty stack:  simpleStack::peek");
+
+		return _array[_count - 1];
 	}
 
 	template<isHashable T>
 	int simpleStack<T>::count() const
 	{
-		return _list->count();
+		return _count;
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::clear()
+	{
+		// Soft Delete:  capacity is kept
+		std::destroy_n(_array, _count);
+
+		_count = 0;
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::reserve(int capacity)
+	{
+		if (capacity > _capacity)
+			this->reAllocate(capacity);
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::reAllocate(int minCapacity)
+	{
+		// Doubling
+		int newCapacity = simpleMath::maxOf(minCapacity, _capacity * 2, 8);
+
+		// (MEMORY!) Uninitialized storage
+		T* newArray = std::allocator<T>().allocate(newCapacity);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (_count > 0)
+				std::memcpy((void*)newArray, (const void*)_array, _count * sizeof(T));
+		}
+		else
+		{
+			std::uninitialized_move_n(_array, _count, newArray);
+			std::destroy_n(_array, _count);
+		}
+
+		if (_array != nullptr)
+			std::allocator<T>().deallocate(_array, _capacity);
+
+		_array = newArray;
+		_capacity = newCapacity;
+	}
+
+	template<isHashable T>
+	size_t simpleStack<T>::getHash() const
+	{
+		size_t hash = 0;
+
+		for (int index = 0; index < _count; index++)
+		{
+			if (hash == 0)
+				hash = hashGenerator::generateHash(_array[index]);
+
+			else
+				hash = hashGenerator::combineHash(hash, _array[index]);
+		}
+
+		return hash;
+	}
+
+	template<isHashable T>
+	void simpleStack<T>::forEach(simpleStackIterator<T> callback) const
+	{
+		for (int index = _count - 1; index >= 0; index--)
+		{
+			if (callback(_array[index]) == iterationCallback::breakAndReturn)
+				return;
+		}
 	}
-}
\ No newline at end of file
+}
@@ -4,40 +4,60 @@
 #include "simpleArray.h"
 #include "simpleException.h"
 #include "simpleList.h"
+#include "simpleMath.h"
+#include "simpleNumber.h"
+#include "simpleStringSearch.h"
+#include "simpleStringView.h"
 #include <cctype>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
 #include <iosfwd>
 #include <iostream>
+#include <limits>
 #include <string>
 
 namespace simple
 {
+	/// <summary>
+	/// Character string with small-string storage:  strings of up to SmallCapacity characters are
+	/// stored inline (no heap allocation). The capacity is kept apart from the count; and grows
+	/// geometrically, so repeated appends are amortized O(1) per character.
+	/// </summary>
 	class simpleString : public simpleObject
 	{
 	protected:
 
 		/// <summary>
-		/// This should be taken from the std library or boost. I wasn't sure of the limit; but the
-		/// strlen_s function asked for one.
+		/// Upper bound for the length of a string (the count is an int); and for strnlen_s
 		/// </summary>
-		static const size_t MAX_LENGTH = 1000000;
-		static const size_t MAX_SPLIT_TOKENS = 10;
+		static constexpr int MAX_LENGTH = std::numeric_limits<int>::max() - 1;
 		static const char NULL_CHAR = '\0';
 
+	public:
+
+		/// <summary>
+		/// Number of characters stored inline (the null terminator is stored after these)
+		/// </summary>
+		static constexpr int SmallCapacity = 22;
+
 	public:
 
 		simpleString();
 		simpleString(int count);
 		simpleString(const char character);
 		simpleString(const char* chars);
+		simpleString(const char* chars, int length);
 		simpleString(const std::string& stdStr);
+		explicit simpleString(const simpleStringView& view);
 		simpleString(const simpleString& copy);
+		simpleString(simpleString&& other) noexcept;
 		~simpleString();
 
 		void operator=(const simpleString& other);
+		void operator=(simpleString&& other) noexcept;
 		void operator=(const char* other);
 
 		bool operator==(const simpleString& other) const;
@@ -48,25 +68,63 @@ namespace simple
 
 		bool operator==(const char* other) const;
 		bool operator!=(const char* other) const;
+		bool operator==(const simpleStringView& other) const;
+		bool operator!=(const simpleStringView& other) const;
+
+		/// <summary>
+		/// View of the characters (valid until the string is modified)
+		/// </summary>
+		operator simpleStringView() const;
 
 		char get(int index) const;
 		int count() const;
+		int capacity() const;
 		bool isEmpty() const;
 		bool isEmptyOrWhiteSpace() const;
 		int search(const char* search) const;
 		int search(const simpleString& search) const;
 
+		/// <summary>
+		/// Index of the first match at (or after) the start index; or -1 (see simpleStringSearch)
+		/// </summary>
+		int indexOf(const simpleStringView& pattern, int startIndex = 0) const;
+
+		/// <summary>
+		/// Index of the last match; or -1
+		/// </summary>
+		int lastIndexOf(const simpleStringView& pattern) const;
+		int lastIndexOf(const simpleStringView& pattern, int startIndex) const;
+
+		/// <summary>
+		/// Number of (non-overlapping) matches of the pattern
+		/// </summary>
+		int countOf(const simpleStringView& pattern) const;
+
 		bool endsWith(const char* chars) const;
 
 		void set(int index, char value);
 		void clear();
 
+		/// <summary>
+		/// Ensures room for (at least) the capacity (characters) without further allocation
+		/// </summary>
+		void reserve(int capacity);
+
 		void append(const simpleString& other);
 		void append(const char* chars);
+		void append(const char* chars, int length);
+		void append(char character);
 		void appendLine(const simpleString& other);
 		void appendLine(const char* chars);
 
 		void appendPadding(char padChar, int length);
+
+		/// <summary>
+		/// Appends the number (std::to_chars; shortest round-trip form for floating point)
+		/// </summary>
+		template<isNumber T>
+		void appendNumber(T value);
+
 		void insert(int index, const char* replacement);
 		void insert(int index, const simpleString& replacement);
 		void remove(int index, int count);
@@ -74,11 +132,55 @@ namespace simple
 		void replace(const char* string, const char* replacement);
 		void replaceFirst(const simpleString& string, const simpleString& replacement);
 
+		/// <summary>
+		/// Replaces every (non-overlapping, left to right) match of the pattern in one pass:  in place
+		/// when the result is not longer; otherwise into one new buffer of the final size. Returns the
+		/// number of replacements.
+		/// </summary>
+		int replaceAll(const simpleStringView& pattern, const simpleStringView& replacement);
+
+		/// <summary>
+		/// ASCII case conversion in place (other characters are not changed)
+		/// </summary>
+		void toUpperInPlace();
+		void toLowerInPlace();
+
+		/// <summary>
+		/// Removes leading / trailing white space in place
+		/// </summary>
+		void trim();
+
 		simpleString subString(int index, int count) const;
 		simpleArray<simpleString> split(char token) const;
+
+		/// <summary>
+		/// Splits on any of the token characters (empty / white space pieces are removed)
+		/// </summary>
 		simpleArray<simpleString> split(const char* tokens) const;
 
+	public:	// Views:  No characters are copied (valid until the string is modified)
+
+		simpleStringView subView(int index, int count) const;
+
+		/// <summary>
+		/// Splits on the token; keeping empty fields (e.g. "a,,b" -> "a", "", "b")
+		/// </summary>
+		simpleArray<simpleStringView> splitView(char token) const;
+
+		/// <summary>
+		/// Splits on the token into the (cleared) list; so the list's storage may be reused line by line
+		/// </summary>
+		void splitView(char token, simpleList<simpleStringView>& result) const;
+
+		/// <summary>
+		/// Lazy tokenizer over the pieces between any of the delimiter characters
+		/// </summary>
+		simpleStringTokenizer tokenize(const char* delimiters) const;
+
+	public:
+
 		simpleString toUpper() const;
+		simpleString toLower() const;
 
 		const char* c_str() const;
 
@@ -86,6 +188,11 @@ namespace simple
 
 		size_t getHash() const override;
 
+		/// <summary>
+		/// Seeded hash of the string contents (see simpleHashStdKey::processSeed())
+		/// </summary>
+		size_t getHash(size_t seed) const;
+
 	public:
 
 		//template<isStringConvertible T, isStringConvertible...Rest>
@@ -98,6 +205,10 @@ namespace simple
 		//friend simpleString& operator+(const char* left, const simpleString& right);
 		//friend simpleString& operator+(const simpleString& left, const char* right);
 
+		/// <summary>
+		/// Number conversions (std::from_chars):  The whole string must be a number (surrounding white
+		/// space is allowed); otherwise these throw.
+		/// </summary>
 		int toInt();
 		bool tryToInt(int& result);
 		long toLong();
@@ -106,80 +217,222 @@ namespace simple
 		double toDouble();
 		bool toBool();
 
-	private:
+		/// <summary>
+		/// Parses the whole string as a number (see simpleNumber::tryParse); and returns false on failure
+		/// </summary>
+		template<isNumber T>
+		bool tryParse(T& result) const;
 
-		int searchImpl(int startIndex, const simpleString& search) const;
+	private:
 
-		void copyImpl(const simpleString& copy);
-		void copyImpl(const char* copy);
+		void copyImpl(const char* chars, int length);
 
 		bool compare(const simpleString& other) const;
 		bool compareArray(const char* other) const;
 
+		bool isSmall() const;
+
+		/// <summary>
+		/// True if the characters are inside of this string's storage
+		/// </summary>
+		bool isOwnStorage(const char* chars) const;
+
+		/// <summary>
+		/// Flips the case of the ASCII letters in [lowLetter, lowLetter + 25]; eight characters at a
+		/// time (SWAR - bit tricks on a 64-bit word)
+		/// </summary>
+		static void changeCase(char* chars, int count, char lowLetter);
+
+		/// <summary>
+		/// Grows the capacity (geometric) to fit (at least) the count; keeping the contents
+		/// </summary>
+		void ensureCapacity(int count);
+
+		/// <summary>
+		/// Sets the count (within the capacity); and the null terminator
+		/// </summary>
+		void setCount(int count);
+
 	private:
 
-		simpleArray<char>* _array;
+		// Points to either the inline buffer, or the heap storage (always null terminated)
+		char* _data;
+
+		int _count;
+
+		// Characters (not including the null terminator)
+		int _capacity;
+
+		char _small[SmallCapacity + 1];
 	};
 
 	simpleString::simpleString()
 	{
-		// Pin down array value
-		_array = new simpleArray<char>(0);
+		_data = _small;
+		_count = 0;
+		_capacity = SmallCapacity;
+		_small[0] = NULL_CHAR;
 	}
 	simpleString::simpleString(int count)
+		: simpleString()
 	{
 		if (count >= this->MAX_LENGTH)
-			throw simpleException("Trying to declare simpleString greater than 1MB");
+			throw simpleException("Trying to declare simpleString greater than MAX_LENGTH");
+
+		this->ensureCapacity(count);
 
-		_array = new simpleArray<char>(count);
+		std::memset(_data, NULL_CHAR, count);
+
+		this->setCount(count);
 	}
 	simpleString::simpleString(const char character)
+		: simpleString()
 	{
-		_array = new simpleArray<char>(1);
-
-		_array->set(0, character);
+		this->append(character);
 	}
 	simpleString::simpleString(const char* chars)
+		: simpleString()
 	{
-		// Pin down array value
-		_array = new simpleArray<char>(0);
+		if (chars == nullptr)
+			throw simpleException("Trying to declare simpleString from nullptr:  simpleString.h");
 
-		this->copyImpl(chars);
+		this->copyImpl(chars, (int)strnlen_s(chars, this->MAX_LENGTH));
 	}
-	simpleString::simpleString(const std::string& stdStr)
+	simpleString::simpleString(const char* chars, int length)
+		: simpleString()
 	{
-		_array = new simpleArray<char>(stdStr.size());
+		if (chars == nullptr && length > 0)
+			throw simpleException("Trying to declare simpleString from nullptr:  simpleString.h");
 
-		for (int index = 0; index < _array->count(); index++)
-		{
-			_array->set(index, stdStr[index]);
-		}
+		this->copyImpl(chars, length);
+	}
+	simpleString::simpleString(const std::string& stdStr)
+		: simpleString()
+	{
+		this->copyImpl(stdStr.data(), (int)stdStr.size());
+	}
+	simpleString::simpleString(const simpleStringView& view)
+		: simpleString()
+	{
+		this->copyImpl(view.getChars(), view.count());
 	}
 	simpleString::simpleString(const simpleString& copy)
+		: simpleString()
 	{
-		// Pin down array value
-		_array = new simpleArray<char>(0);
-
-		this->copyImpl(copy);
+		this->copyImpl(copy.c_str(), copy.count());
+	}
+	simpleString::simpleString(simpleString&& other) noexcept
+		: simpleString()
+	{
+		*this = std::move(other);
 	}
 	simpleString::~simpleString()
 	{
-		delete _array;
+		// (MEMORY!) Heap storage only
+		if (!this->isSmall())
+			delete[] _data;
+
+		_data = nullptr;
+		_count = 0;
+		_capacity = 0;
 	}
 
 	void simpleString::operator=(const simpleString& copy)
 	{
-		// Pin down array value
-		_array = new simpleArray<char>(0);
+		if (this == &copy)
+			return;
+
+		this->copyImpl(copy.c_str(), copy.count());
+	}
+	void simpleString::operator=(simpleString&& other) noexcept
+	{
+		if (this == &other)
+			return;
+
+		// Small:  Copy the inline characters
+		if (other.isSmall())
+		{
+			std::memcpy(_data, other._data, other._count + 1);
+
+			_count = other._count;
+
+			other.setCount(0);
+			return;
+		}
+
+		// Heap:  Take the other's storage
+		if (!this->isSmall())
+			delete[] _data;
+
+		_data = other._data;
+		_count = other._count;
+		_capacity = other._capacity;
 
-		this->copyImpl(copy);
+		other._data = other._small;
+		other._count = 0;
+		other._capacity = SmallCapacity;
+		other._small[0] = NULL_CHAR;
 	}
 	void simpleString::operator=(const char* copy)
 	{
-		// Pin down array value
-		_array = new simpleArray<char>(0);
+		if (copy == nullptr)
+			throw simpleException("Trying to declare simpleString from nullptr:  simpleString.h");
 
-		this->copyImpl(copy);
+		size_t length = strnlen_s(copy, this->MAX_LENGTH);
+
+		// (Self-assignment:  the characters may be our own)
+		if (copy >= _data && copy <= _data + _count)
+		{
+			std::memmove(_data, copy, length);
+			this->setCount((int)length);
+			return;
+		}
+
+		this->copyImpl(copy, (int)length);
+	}
+
+	bool simpleString::isSmall() const
+	{
+		return _data == _small;
+	}
+
+	bool simpleString::isOwnStorage(const char* chars) const
+	{
+		return chars >= _data && chars <= _data + _capacity;
+	}
+
+	void simpleString::ensureCapacity(int count)
+	{
+		if (count <= _capacity)
+			return;
+
+		if (count >= this->MAX_LENGTH)
+			throw simpleException("Trying to grow simpleString greater than MAX_LENGTH");
+
+		// Doubling (clamped to the MAX_LENGTH)
+		int newCapacity = (_capacity >= this->MAX_LENGTH / 2) ? this->MAX_LENGTH : simpleMath::maxOf(count, _capacity * 2);
+
+		// (MEMORY!) Null terminator included
+		char* newData = new char[newCapacity + 1];
+
+		std::memcpy(newData, _data, _count + 1);
+
+		if (!this->isSmall())
+			delete[] _data;
+
+		_data = newData;
+		_capacity = newCapacity;
+	}
+
+	void simpleString::setCount(int count)
+	{
+		_count = count;
+		_data[count] = NULL_CHAR;
+	}
+
+	void simpleString::reserve(int capacity)
+	{
+		this->ensureCapacity(capacity);
 	}
 
 	bool simpleString::operator==(const simpleString& other) const
@@ -198,10 +451,22 @@ namespace simple
 	{
 		return !compareArray(other);
 	}
+	bool simpleString::operator==(const simpleStringView& other) const
+	{
+		return _count == other.count() && std::memcmp(_data, other.getChars(), _count) == 0;
+	}
+	bool simpleString::operator!=(const simpleStringView& other) const
+	{
+		return !(*this == other);
+	}
+	simpleString::operator simpleStringView() const
+	{
+		return simpleStringView(_data, _count);
+	}
 
 	//simpleString simpleString::operator+(const simpleString& other) const
 	//{
-	//	simpleString result(_array->getArray());
+	//	simpleString result(_data);
 
 	//	result.append(other);
 
@@ -209,7 +474,7 @@ namespace simple
 	//}
 	//simpleString simpleString::operator+(const char* other) const
 	//{
-	//	simpleString result(_array->getArray());
+	//	simpleString result(_data);
 
 	//	result.append(other);
 
@@ -259,194 +524,136 @@ namespace simple
 		if (chars == nullptr)
 			throw simpleException("Trying to compare a string with a nullptr:  simpleString::endsWith");
 
-		simpleString charsStr(chars);
+		int length = (int)strnlen_s(chars, this->MAX_LENGTH);
 
-		if (charsStr.count() > this->count())
+		if (length > _count)
 			return false;
 
-		int difference = this->count() - charsStr.count();
-
-		for (int index = charsStr.count() - 1; index >= 0; index--)
-		{
-			if (this->get(index + difference) != charsStr.get(index))
-				return false;
-		}
-
-		return true;
+		return std::memcmp(_data + _count - length, chars, length) == 0;
 	}
 
 	bool simpleString::compare(const simpleString& other) const
 	{
-		// NEED DEFAULT VALUE HANDLERS
-		if (other == nullptr)
+		if (_count != other.count())
 			return false;
 
-		else if (_array == nullptr)
-			return other.count() == 0;
-
-		else if (_array->count() != other.count())
-			return false;
-
-		for (int index = 0; index < _array->count(); index++)
-		{
-			if (_array->get(index) != other.get(index))
-				return false;
-		}
-
-		return true;
+		return std::memcmp(_data, other.c_str(), _count) == 0;
 	}
 	bool simpleString::compareArray(const char* other) const
 	{
-		if (_array == nullptr)
-			return (other == nullptr);
-
-		else if (other == nullptr)
-			return (_array == nullptr);
-
-		else if (strnlen_s(other, _array->count()) != _array->count())
+		if (other == nullptr)
 			return false;
 
-		for (int index = 0; index < _array->count(); index++)
-		{
-			if (_array->get(index) != other[index])
-				return false;
-		}
+		// Also checks that the other ends here (strnlen_s stops at the count + 1)
+		else if (strnlen_s(other, _count + 1) != (size_t)_count)
+			return false;
 
-		return true;
+		return std::memcmp(_data, other, _count) == 0;
 	}
 
 	void simpleString::append(const simpleString& other)
 	{
-		this->append(other.c_str());
+		this->append(other.c_str(), other.count());
 	}
 	void simpleString::append(const char* other)
 	{
-		int otherCount = strnlen_s(other, this->MAX_LENGTH);
+		if (other == nullptr)
+			throw simpleException("Trying to append a nullptr:  simpleString::append");
 
-		// Handle default case
-		if (this->isEmptyOrWhiteSpace())
+		this->append(other, (int)strnlen_s(other, this->MAX_LENGTH));
+	}
+	void simpleString::append(const char* chars, int length)
+	{
+		if (length <= 0)
+			return;
+
+		// The characters may be our own (e.g. str.append(str)):  Keep the offset across the re-allocation
+		if (chars >= _data && chars <= _data + _count)
 		{
-			delete _array;
+			int offset = (int)(chars - _data);
+
+			this->ensureCapacity(_count + length);
 
-			_array = new simpleArray<char>(other, otherCount);
+			std::memmove(_data + _count, _data + offset, length);
 		}
 		else
 		{
-			int count = _array->count() + otherCount;
+			this->ensureCapacity(_count + length);
 
-			simpleArray<char>* newArray = new simpleArray<char>(count);
-
-			// Copy over data to new array
-			for (int index = 0; index < _array->count(); index++)
-				newArray->set(index, _array->get(index));
+			std::memcpy(_data + _count, chars, length);
+		}
 
-			for (int index = _array->count(); index < count; index++)
-				newArray->set(index, other[index - _array->count()]);
+		this->setCount(_count + length);
+	}
+	void simpleString::append(char character)
+	{
+		this->ensureCapacity(_count + 1);
 
-			delete _array;
+		_data[_count] = character;
 
-			_array = newArray;
-		}
+		this->setCount(_count + 1);
 	}
 	void simpleString::appendLine(const simpleString& other)
 	{
 		this->append(other);
-		this->appendPadding('\n', 1);
+		this->append('\n');
 	}
 	void simpleString::appendLine(const char* chars)
 	{
 		this->append(chars);
-		this->appendPadding('\n', 1);
+		this->append('\n');
 	}
 	void simpleString::appendPadding(char padChar, int length)
 	{
-		// TODO: Figure out how to create an empty space string without garbage 
-		//		 and / or heap corruption.
-		//
-		for (int index = 0; index < length; index++)
-		{
-			this->append(padChar);
-		}
+		if (length <= 0)
+			return;
+
+		this->ensureCapacity(_count + length);
+
+		std::memset(_data + _count, padChar, length);
+
+		this->setCount(_count + length);
 	}
 
 	int simpleString::search(const char* search) const
 	{
-		return this->search(simpleString(search));
+		return this->indexOf(search, 0);
 	}
 	int simpleString::search(const simpleString& search) const
 	{
-		return this->searchImpl(0, search);
+		return this->indexOf(search, 0);
 	}
-	int simpleString::searchImpl(int startIndex, const simpleString& search) const
+	int simpleString::indexOf(const simpleStringView& pattern, int startIndex) const
 	{
-		if (search.count() == 0)
-			throw simpleException("Trying to search for zero-count string simpleString::search");
-
-		int firstIndex = -1;
-
-		for (int index = startIndex; index < _array->count(); index++)
-		{
-			if (firstIndex == -1)
-			{
-				// Found the beginning character
-				if (_array->get(index) == search.get(0))
-					firstIndex = index;
-			}
-
-			// Tracking a possible match
-			else
-			{
-				// Found all characters!
-				if (index - firstIndex >= search.count())
-				{
-					return firstIndex;
-				}
-
-				// Found mismatch (reset)
-				else if (_array->get(index) != search.get(index - firstIndex))
-				{
-					firstIndex = -1;
-				}
-
-				else
-				{
-					// Nothing to do
-				}
-			}
-		}
-
-		return firstIndex;
+		return simpleStringSearch::indexOf(*this, pattern, startIndex);
 	}
-
-	void simpleString::copyImpl(const simpleString& copy)
+	int simpleString::lastIndexOf(const simpleStringView& pattern) const
 	{
-		if (copy == nullptr)
-			throw simpleException("Trying to declare simpleString from nullptr:  simpleString.h");
-
-		if (copy.count() >= this->MAX_LENGTH)
-			throw simpleException("Trying to declare simpleString greater than 1MB");
-
-		delete _array;
-
-		_array = new simpleArray<char>(copy.count());
-
-		for (int index = 0; index < copy.count(); index++)
-			_array->set(index, copy.get(index));
+		return simpleStringSearch::lastIndexOf(*this, pattern);
+	}
+	int simpleString::lastIndexOf(const simpleStringView& pattern, int startIndex) const
+	{
+		return simpleStringSearch::lastIndexOf(*this, pattern, startIndex);
+	}
+	int simpleString::countOf(const simpleStringView& pattern) const
+	{
+		return simpleStringSearch::countOf(*this, pattern);
 	}
 
-	void simpleString::copyImpl(const char* copy)
+	void simpleString::copyImpl(const char* chars, int length)
 	{
-		if (copy == nullptr)
-			throw simpleException("Trying to declare simpleString from nullptr:  simpleString.h");
+		if (length >= this->MAX_LENGTH)
+			throw simpleException("Trying to declare simpleString greater than MAX_LENGTH");
 
-		size_t length = strnlen_s(copy, this->MAX_LENGTH);
+		// Contents are replaced:  Drop them before growing (nothing to copy)
+		this->setCount(0);
 
-		if (length >= this->MAX_LENGTH)
-			throw simpleException("Trying to declare simpleString greater than 1MB");
+		this->ensureCapacity(length);
 
-		delete _array;
+		if (length > 0)
+			std::memcpy(_data, chars, length);
 
-		_array = new simpleArray<char>(copy, length);
+		this->setCount(length);
 	}
 
 	void simpleString::insert(int index, const char* replacement)
@@ -455,79 +662,116 @@ namespace simple
 	}
 	void simpleString::insert(int index, const simpleString& replacement)
 	{
-		if (index >= _array->count())
+		if (index < 0 || index > _count)
 			throw simpleException("Index for insert was outside the bounds of the array:  simpleString.cpp");
 
-		simpleArray<char>* newArray = new simpleArray<char>(_array->count() + replacement.count());
-
-		// Iterate the new array indices
-		for (int i = 0; i < newArray->count(); i++)
+		// (The replacement is read after the move)
+		if (&replacement == this)
 		{
-			// Inside replacement indices
-			if (i >= index && i < index + replacement.count())
-			{
-				newArray->set(i, replacement.get(i - index));
-			}
-			else if (i >= index)
-			{
-				newArray->set(i, _array->get(i - replacement.count()));
-			}
-			else
-				newArray->set(i, _array->get(i));
+			this->insert(index, simpleString(replacement));
+			return;
 		}
 
-		delete _array;
+		int length = replacement.count();
 
-		_array = newArray;
+		this->ensureCapacity(_count + length);
+
+		// Shift the tail (with the terminator); then copy in the replacement
+		std::memmove(_data + index + length, _data + index, _count - index + 1);
+		std::memcpy(_data + index, replacement.c_str(), length);
+
+		_count += length;
 	}
 	void simpleString::remove(int index, int count)
 	{
-		if (index + count > _array->count())
+		if (index < 0 || count < 0 || index + count > _count)
 			throw simpleException("Index for remove was outside the bounds of the array:  simpleString.cpp");
 
-		simpleArray<char>* newArray = new simpleArray<char>(_array->count() - count);
+		// Shift the tail (with the terminator) over the removed characters
+		std::memmove(_data + index, _data + index + count, _count - index - count + 1);
 
-		// Iterate current array
-		for (int i = 0; i < _array->count(); i++)
+		_count -= count;
+	}
+	void simpleString::replace(const simpleString& string, const simpleString& replacement)
+	{
+		this->replaceAll(string, replacement);
+	}
+	void simpleString::replace(const char* string, const char* replacement)
+	{
+		this->replaceAll(string, replacement);
+	}
+	int simpleString::replaceAll(const simpleStringView& pattern, const simpleStringView& replacement)
+	{
+		// Arguments that view this string are copied first (the characters are re-written below)
+		if (this->isOwnStorage(pattern.getChars()) || this->isOwnStorage(replacement.getChars()))
 		{
-			// Inside the removed character indices
-			if (i >= index && (i - index) < count)
-			{
-				continue;
-			}
-			else if (i >= index)
+			simpleString patternCopy(pattern);
+			simpleString replacementCopy(replacement);
+
+			return this->replaceAll(patternCopy, replacementCopy);
+		}
+
+		int matchCount = this->countOf(pattern);
+
+		if (matchCount == 0)
+			return 0;
+
+		int patternCount = pattern.count();
+		int replacementCount = replacement.count();
+		long long resultCount = _count + (long long)matchCount * (replacementCount - patternCount);
+
+		if (resultCount >= (long long)this->MAX_LENGTH)
+			throw simpleException("Trying to grow simpleString greater than MAX_LENGTH:  simpleString::replaceAll");
+
+		// Not longer:  Compact in place (the write position never passes the read position)
+		if (replacementCount <= patternCount)
+		{
+			int readIndex = 0;
+			int writeIndex = 0;
+			int matchIndex = this->indexOf(pattern, 0);
+
+			while (matchIndex >= 0)
 			{
-				newArray->set(i - count, _array->get(i));
+				std::memmove(_data + writeIndex, _data + readIndex, matchIndex - readIndex);
+				writeIndex += matchIndex - readIndex;
+
+				std::memcpy(_data + writeIndex, replacement.getChars(), replacementCount);
+				writeIndex += replacementCount;
+
+				readIndex = matchIndex + patternCount;
+				matchIndex = this->indexOf(pattern, readIndex);
 			}
-			else
-				newArray->set(i, _array->get(i));
-		}
 
-		// Replace with the new array
-		delete _array;
+			std::memmove(_data + writeIndex, _data + readIndex, _count - readIndex);
 
-		_array = newArray;
-	}
-	void simpleString::replace(const simpleString& string, const simpleString& replacement)
-	{
-		int searchIndex = this->search(string);
+			this->setCount((int)resultCount);
+		}
 
-		while (searchIndex != -1)
+		// Longer:  Copy into a new buffer of the final size
+		else
 		{
-			this->remove(searchIndex, string.count());
-			this->insert(searchIndex, replacement);
+			simpleString result;
 
-			if (searchIndex + replacement.count() > _array->count())
-				break;
+			result.reserve((int)resultCount);
 
-			// Increment past the last replacement
-			else
-				searchIndex = this->searchImpl(searchIndex + replacement.count(), string);
+			int readIndex = 0;
+			int matchIndex = this->indexOf(pattern, 0);
+
+			while (matchIndex >= 0)
+			{
+				result.append(_data + readIndex, matchIndex - readIndex);
+				result.append(replacement.getChars(), replacementCount);
+
+				readIndex = matchIndex + patternCount;
+				matchIndex = this->indexOf(pattern, readIndex);
+			}
+
+			result.append(_data + readIndex, _count - readIndex);
+
+			*this = std::move(result);
 		}
-	}
-	void simpleString::replace(const char* string, const char* replacement)
-	{
-		this->replace(simpleString(string), simpleString(replacement));
+
+		return matchCount;
 	}
 	void simpleString::replaceFirst(const simpleString& string, const simpleString& replacement)
 	{
@@ -547,53 +791,60 @@ namespace simple
 
 	char simpleString::get(int index) const
 	{
-		return _array->get(index);
+		if (index < 0 || index >= _count)
+			throw simpleException("Index outside the bounds of the string:  simpleString::get");
+
+		return _data[index];
 	}
 	int simpleString::count() const
 	{
-		return _array->count();
+		return _count;
+	}
+	int simpleString::capacity() const
+	{
+		return _capacity;
 	}
 	bool simpleString::isEmpty() const
 	{
-		return _array->count() == 0 ||
-			_array->areAll('\0');
+		for (int index = 0; index < _count; index++)
+		{
+			if (_data[index] != NULL_CHAR)
+				return false;
+		}
+
+		return true;
 	}
 	bool simpleString::isEmptyOrWhiteSpace() const
 	{
-		return _array->count() == 0 ||
-			_array->areAllWhere([] (char value)
+		for (int index = 0; index < _count; index++)
 		{
-			return value == '\0' || std::isspace(value);
-		});
+			if (_data[index] != NULL_CHAR && !std::isspace((unsigned char)_data[index]))
+				return false;
+		}
+
+		return true;
 	}
 
 	void simpleString::set(int index, char value)
 	{
-		_array->set(index, value);
+		if (index < 0 || index >= _count)
+			throw simpleException("Index outside the bounds of the string:  simpleString::set");
+
+		_data[index] = value;
 	}
 
 	void simpleString::clear()
 	{
-		// Delete and reallocate
-		if (_array != nullptr)
-		{
-			delete _array;
-		}
-
-		_array = new simpleArray<char>(0);
+		// Soft Delete:  capacity is kept
+		this->setCount(0);
 	}
 
 	simpleString simpleString::subString(int index, int count) const
 	{
-		if (index + count > _array->count())
+		if (index < 0 || count < 0 || index + count > _count)
 			throw simpleException("Index outside the bounds of the array: simpleArray::subString");
 
-		simpleString result(count);
-
-		for (int i = index; i < index + count; i++)
-			result.set(i - index, _array->get(i));
-
-		return result;
+		return simpleString(_data + index, count);
 	}
 
 	simpleArray<simpleString> simpleString::split(char token) const
@@ -602,10 +853,10 @@ namespace simple
 
 		int lastIndex = -1;
 
-		for (int strIndex = 0; strIndex < _array->count(); strIndex++)
+		for (int strIndex = 0; strIndex < _count; strIndex++)
 		{
 			// Found token!
-			if (_array->get(strIndex) == token)
+			if (_data[strIndex] == token)
 			{
 				simpleString subString = (lastIndex == -1) ? this->subString(0, strIndex) : this->subString(lastIndex + 1, strIndex - lastIndex - 1);
 
@@ -617,10 +868,10 @@ namespace simple
 
 		// Add the last sub-string
 		if (lastIndex != -1)
-			result.add(this->subString(lastIndex + 1, _array->count() - lastIndex - 1));
+			result.add(this->subString(lastIndex + 1, _count - lastIndex - 1));
 
 		else
-			result.add(this->subString(0, _array->count()));	// Take entire substring on stack
+			result.add(this->subString(0, _count));	// Take entire substring on stack
 
 		// Prune for empty strings
 		for (int index = result.count() - 1; index >= 0; index--)
@@ -634,87 +885,164 @@ namespace simple
 
 	simpleArray<simpleString> simpleString::split(const char* tokens) const
 	{
-		size_t length = strnlen_s(tokens, this->MAX_SPLIT_TOKENS);
-
-		if (length > this->MAX_SPLIT_TOKENS)
-			throw simpleException("Cannot have simpleString::split const char* tokens length greater than 30");
+		if (tokens == nullptr)
+			throw simpleException("Trying to split with nullptr tokens:  simpleString::split");
 
+		simpleStringTokenizer tokenizer(*this, tokens);
+		simpleStringView token;
 		simpleList<simpleString> result;
-		simpleList<simpleString> list;
-
-		result.add(this->subString(0, _array->count()));
 
-		for (int index = 0; index < length; index++)
+		while (tokenizer.next(token))
 		{
-			char token = tokens[index];
+			// Prune for empty strings
+			if (!token.trim().isEmpty())
+				result.add(simpleString(token));
+		}
 
-			list.clear();
+		return result.toArray();
+	}
 
-			// Iterate the result list, swap back to list
-			for (int index = 0; index < result.count(); index++)
-			{
-				simpleArray<simpleString> strings = result.get(index).split(token);
+	simpleStringView simpleString::subView(int index, int count) const
+	{
+		if (index < 0 || count < 0 || index + count > _count)
+			throw simpleException("Index outside the bounds of the string:  simpleString::subView");
 
-				list.addRange(strings.getArray(), strings.count());
-			}
+		return simpleStringView(_data + index, count);
+	}
 
-			result.clear();
-			result.addRange(list);
-			list.clear();
-		}
+	simpleArray<simpleStringView> simpleString::splitView(char token) const
+	{
+		simpleList<simpleStringView> result;
 
-		// Prune for empty strings
-		for (int index = result.count() - 1; index >= 0; index--)
+		this->splitView(token, result);
+
+		return result.toArray();
+	}
+
+	void simpleString::splitView(char token, simpleList<simpleStringView>& result) const
+	{
+		result.clear();
+
+		const char* start = _data;
+		const char* end = _data + _count;
+
+		while (true)
 		{
-			if (result.get(index).isEmptyOrWhiteSpace())
-				result.removeAt(index);
+			const char* found = (const char*)std::memchr(start, token, end - start);
+
+			if (found == nullptr)
+			{
+				result.add(simpleStringView(start, (int)(end - start)));
+				return;
+			}
+
+			result.add(simpleStringView(start, (int)(found - start)));
+
+			start = found + 1;
 		}
+	}
 
-		return result.toArray();
+	simpleStringTokenizer simpleString::tokenize(const char* delimiters) const
+	{
+		return simpleStringTokenizer(*this, delimiters);
 	}
 
 	simpleString simpleString::toUpper() const
 	{
-		simpleString result(_array->count());
+		simpleString result(*this);
 
-		for (int index = 0; index < result.count(); index++)
-			result.set(index, toupper(_array->get(index)));
+		result.toUpperInPlace();
 
 		return result;
 	}
+	simpleString simpleString::toLower() const
+	{
+		simpleString result(*this);
 
-	int simpleString::toInt()
+		result.toLowerInPlace();
+
+		return result;
+	}
+	void simpleString::toUpperInPlace()
 	{
-		return atoi(_array->getArray());
+		simpleString::changeCase(_data, _count, 'a');
 	}
-	bool simpleString::tryToInt(int& result)
+	void simpleString::toLowerInPlace()
 	{
-		try
+		simpleString::changeCase(_data, _count, 'A');
+	}
+	void simpleString::changeCase(char* chars, int count, char lowLetter)
+	{
+		// Per byte (7-bit):  (byte + (0x80 - low)) sets the high bit when byte >= low
+		const uint64_t ones = 0x0101010101010101ull;
+		const uint64_t highBits = 0x8080808080808080ull;
+		const uint64_t aboveLow = ones * (uint64_t)(0x80 - lowLetter);
+		const uint64_t aboveHigh = ones * (uint64_t)(0x80 - (lowLetter + 26));
+
+		int index = 0;
+
+		for (; index + 8 <= count; index += 8)
 		{
-			result = this->toInt();
+			uint64_t word;
 
-			return true;
+			std::memcpy(&word, chars + index, 8);
+
+			uint64_t low7 = word & ~highBits;
+
+			// Letters:  >= low; not > high; and ASCII (high bit clear)
+			uint64_t letters = (low7 + aboveLow) & ~(low7 + aboveHigh) & ~word & highBits;
+
+			// 0x80 >> 2 == 0x20 (the case bit)
+			word ^= letters >> 2;
+
+			std::memcpy(chars + index, &word, 8);
 		}
-		catch (std::exception ex)
+
+		for (; index < count; index++)
 		{
-			return false;
+			if (chars[index] >= lowLetter && chars[index] < lowLetter + 26)
+				chars[index] ^= 0x20;
 		}
 	}
+	void simpleString::trim()
+	{
+		int lowIndex = 0;
+		int highIndex = _count;
+
+		while (lowIndex < highIndex && std::isspace((unsigned char)_data[lowIndex]))
+			lowIndex++;
+
+		while (highIndex > lowIndex && std::isspace((unsigned char)_data[highIndex - 1]))
+			highIndex--;
+
+		std::memmove(_data, _data + lowIndex, highIndex - lowIndex);
+
+		this->setCount(highIndex - lowIndex);
+	}
+
+	int simpleString::toInt()
+	{
+		return simpleNumber::parse<int>(*this);
+	}
+	bool simpleString::tryToInt(int& result)
+	{
+		return simpleNumber::tryParse(*this, result);
+	}
 	long simpleString::toLong()
 	{
-		return atol(_array->getArray());
+		return simpleNumber::parse<long>(*this);
 	}
 	short simpleString::toShort()
 	{
-		return (short)atoi(_array->getArray());
+		return simpleNumber::parse<short>(*this);
 	}
 	float simpleString::toFloat()
 	{
-		return atof(_array->getArray());
+		return simpleNumber::parse<float>(*this);
 	}
 	double simpleString::toDouble()
 	{
-		return (double)atof(_array->getArray());
+		return simpleNumber::parse<double>(*this);
 	}
 	bool simpleString::toBool()
 	{
@@ -726,13 +1054,33 @@ namespace simple
 		return false;
 	}
 
+	template<isNumber T>
+	bool simpleString::tryParse(T& result) const
+	{
+		return simpleNumber::tryParse(*this, result);
+	}
+
+	template<isNumber T>
+	void simpleString::appendNumber(T value)
+	{
+		char buffer[simpleNumber::MaxFormatLength];
+
+		this->append(buffer, simpleNumber::format(value, buffer, simpleNumber::MaxFormatLength));
+	}
+
 	const char* simpleString::c_str() const
 	{
-		return _array->getArray();
+		return _data;
 	}
 
 	size_t simpleString::getHash() const
 	{
-		return _array->getHash();
+		// Bulk-byte hash over the characters (no per-character hash combine)
+		return hashGenerator::generateBytesHash(_data, _count);
+	}
+
+	size_t simpleString::getHash(size_t seed) const
+	{
+		return hashGenerator::generateBytesHash(_data, _count, seed);
 	}
 }
\ No newline at end of file
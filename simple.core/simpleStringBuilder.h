@@ -0,0 +1,250 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include "simpleNumber.h"
+#include "simpleString.h"
+#include <cstring>
+#include <vector>
+
+namespace simple
+{
+	/*
+		String Builder:  Chunked storage for assembling large strings
+
+		- Appends are copied into the last chunk; and a full chunk is never moved or copied again. New
+		  chunks grow with the total (MinChunkSize -> MaxChunkSize); so there are O(log n) chunks for
+		  small builds, and fixed-size chunks for large ones.
+		- toString() materializes the result with a single allocation (one copy per character in all)
+	*/
+	class simpleStringBuilder
+	{
+	public:
+
+		/// <summary>
+		/// Size of the first chunk (characters)
+		/// </summary>
+		static constexpr int MinChunkSize = 256;
+
+		/// <summary>
+		/// Largest chunk that growth will create (larger appends get a chunk of their own size)
+		/// </summary>
+		static constexpr int MaxChunkSize = 1 << 20;
+
+	public:
+
+		simpleStringBuilder();
+		simpleStringBuilder(int capacity);
+		~simpleStringBuilder();
+
+		simpleStringBuilder(const simpleStringBuilder& copy) = delete;
+		void operator=(const simpleStringBuilder& copy) = delete;
+
+		void append(const simpleString& other);
+		void append(const char* chars);
+		void append(const char* chars, int length);
+		void append(char character);
+		void appendLine(const simpleString& other);
+		void appendLine(const char* chars);
+		void appendPadding(char padChar, int length);
+
+		/// <summary>
+		/// Appends the number (see simpleNumber::format)
+		/// </summary>
+		template<isNumber T>
+		void appendNumber(T value);
+
+		/// <summary>
+		/// Number of characters appended
+		/// </summary>
+		int count() const;
+
+		/// <summary>
+		/// Removes the characters (the first chunk is kept for reuse)
+		/// </summary>
+		void clear();
+
+		/// <summary>
+		/// Copies the characters into a new string (single allocation)
+		/// </summary>
+		simpleString toString() const;
+
+		/// <summary>
+		/// Appends the characters to the destination (reserves once)
+		/// </summary>
+		void appendTo(simpleString& destination) const;
+
+	private:
+
+		struct chunk
+		{
+			char* data;
+			int count;
+			int capacity;
+		};
+
+		/// <summary>
+		/// Returns the last chunk; with room for at least one character
+		/// </summary>
+		chunk& getWritableChunk(int length);
+
+	private:
+
+		// (MEMORY!) Chunk data is owned by the builder
+		std::vector<chunk> _chunks;
+
+		int _count;
+	};
+
+	inline simpleStringBuilder::simpleStringBuilder()
+		: simpleStringBuilder(MinChunkSize)
+	{
+	}
+
+	inline simpleStringBuilder::simpleStringBuilder(int capacity)
+	{
+		if (capacity <= 0)
+			throw simpleException("Invalid capacity:  simpleStringBuilder.h");
+
+		_count = 0;
+
+		// (MEMORY!)
+		_chunks.push_back(chunk{ new char[capacity], 0, capacity });
+	}
+
+	inline simpleStringBuilder::~simpleStringBuilder()
+	{
+		// (MEMORY!)
+		for (int index = 0; index < (int)_chunks.size(); index++)
+			delete[] _chunks[index].data;
+
+		_chunks.clear();
+	}
+
+	inline simpleStringBuilder::chunk& simpleStringBuilder::getWritableChunk(int length)
+	{
+		chunk& last = _chunks.back();
+
+		if (last.count < last.capacity)
+			return last;
+
+		// Grow with the total:  Doubles the storage (bounded); or fits the rest of the append
+		int capacity = simpleMath::maxOf(simpleMath::minOf(_count, (int)MaxChunkSize), (int)MinChunkSize, length);
+
+		// (MEMORY!)
+		_chunks.push_back(chunk{ new char[capacity], 0, capacity });
+
+		return _chunks.back();
+	}
+
+	inline void simpleStringBuilder::append(const simpleString& other)
+	{
+		this->append(other.c_str(), other.count());
+	}
+
+	inline void simpleStringBuilder::append(const char* chars)
+	{
+		if (chars == nullptr)
+			throw simpleException("Trying to append a nullptr:  simpleStringBuilder::append");
+
+		this->append(chars, (int)strlen(chars));
+	}
+
+	inline void simpleStringBuilder::append(const char* chars, int length)
+	{
+		while (length > 0)
+		{
+			chunk& target = this->getWritableChunk(length);
+
+			int copyLength = simpleMath::minOf(length, target.capacity - target.count);
+
+			std::memcpy(target.data + target.count, chars, copyLength);
+
+			target.count += copyLength;
+			_count += copyLength;
+
+			chars += copyLength;
+			length -= copyLength;
+		}
+	}
+
+	inline void simpleStringBuilder::append(char character)
+	{
+		chunk& target = this->getWritableChunk(1);
+
+		target.data[target.count++] = character;
+
+		_count++;
+	}
+
+	inline void simpleStringBuilder::appendLine(const simpleString& other)
+	{
+		this->append(other);
+		this->append('\n');
+	}
+
+	inline void simpleStringBuilder::appendLine(const char* chars)
+	{
+		this->append(chars);
+		this->append('\n');
+	}
+
+	inline void simpleStringBuilder::appendPadding(char padChar, int length)
+	{
+		while (length > 0)
+		{
+			chunk& target = this->getWritableChunk(length);
+
+			int padLength = simpleMath::minOf(length, target.capacity - target.count);
+
+			std::memset(target.data + target.count, padChar, padLength);
+
+			target.count += padLength;
+			_count += padLength;
+
+			length -= padLength;
+		}
+	}
+
+	template<isNumber T>
+	void simpleStringBuilder::appendNumber(T value)
+	{
+		char buffer[simpleNumber::MaxFormatLength];
+
+		this->append(buffer, simpleNumber::format(value, buffer, simpleNumber::MaxFormatLength));
+	}
+
+	inline int simpleStringBuilder::count() const
+	{
+		return _count;
+	}
+
+	inline void simpleStringBuilder::clear()
+	{
+		// (MEMORY!)
+		for (int index = 1; index < (int)_chunks.size(); index++)
+			delete[] _chunks[index].data;
+
+		_chunks.resize(1);
+		_chunks[0].count = 0;
+		_count = 0;
+	}
+
+	inline simpleString simpleStringBuilder::toString() const
+	{
+		simpleString result;
+
+		this->appendTo(result);
+
+		return result;
+	}
+
+	inline void simpleStringBuilder::appendTo(simpleString& destination) const
+	{
+		destination.reserve(destination.count() + _count);
+
+		for (int index = 0; index < (int)_chunks.size(); index++)
+			destination.append(_chunks[index].data, _chunks[index].count);
+	}
+}
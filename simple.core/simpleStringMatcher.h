@@ -0,0 +1,374 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleArray.h"
+#include "simpleException.h"
+#include "simpleString.h"
+#include "simpleStringView.h"
+#include <cstring>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace simple
+{
+	/// <summary>
+	/// Callback for a pattern match:  the index of the pattern (in the matcher); and the index of the
+	/// first character of the match in the text.
+	/// </summary>
+	using simpleStringMatchCallback = std::function<iterationCallback(int patternIndex, int index)>;
+
+	/*
+		String Matcher:  Multi-pattern search (Aho-Corasick)
+
+		- The patterns are compiled into one automaton; so the text is scanned once (one table lookup
+		  per character) however many patterns there are.
+		- Characters are mapped to classes (one per distinct pattern character; and one for all other
+		  characters) to keep the transition table small.
+		- forEachMatch reports every match (overlapping); forEachLeftmostMatch reports the
+		  non-overlapping matches a left-to-right replace would use (leftmost; then longest).
+
+		https://en.wikipedia.org/wiki/Aho%E2%80%93Corasick_algorithm
+	*/
+	class simpleStringMatcher
+	{
+	public:
+
+		simpleStringMatcher(const simpleArray<simpleString>& patterns);
+
+		int getPatternCount() const;
+		const simpleString& getPattern(int patternIndex) const;
+
+		/// <summary>
+		/// Calls the callback for every match (including overlapping matches); in order of the end of
+		/// the match.
+		/// </summary>
+		void forEachMatch(const simpleStringView& text, const simpleStringMatchCallback& callback) const;
+
+		/// <summary>
+		/// Calls the callback for the non-overlapping matches (left to right); choosing the leftmost
+		/// match, and then the longest pattern at that index.
+		/// </summary>
+		void forEachLeftmostMatch(const simpleStringView& text, const simpleStringMatchCallback& callback) const;
+
+		/// <summary>
+		/// Index of the first (leftmost) match of any pattern; or -1
+		/// </summary>
+		int indexOf(const simpleStringView& text, int& patternIndex) const;
+
+		bool containsAny(const simpleStringView& text) const;
+
+		/// <summary>
+		/// Returns the text with each leftmost match replaced by the replacement for its pattern
+		/// (replacements[patternIndex]); in one pass, into one buffer of the final size.
+		/// </summary>
+		simpleString replaceAll(const simpleStringView& text, const simpleArray<simpleString>& replacements) const;
+
+	private:
+
+		struct candidate
+		{
+			int index;
+			int length;
+			int patternIndex;
+		};
+
+		/// <summary>
+		/// Priority queue order:  The top is the leftmost; then the longest
+		/// </summary>
+		struct candidateOrder
+		{
+			bool operator()(const candidate& left, const candidate& right) const
+			{
+				return (left.index != right.index) ? left.index > right.index : left.length < right.length;
+			}
+		};
+
+		int transition(int state, char character) const;
+
+	private:
+
+		std::vector<simpleString> _patterns;
+
+		// Character -> class (0 is any character not in a pattern)
+		int _classes[256];
+		int _classCount;
+
+		// State x class -> state (complete DFA; state 0 is the root)
+		std::vector<int> _transitions;
+
+		// Length of the state's prefix
+		std::vector<int> _depth;
+
+		// Pattern ending at the state (-1 if none); and the next state on the suffix chain that
+		// ends a pattern (-1 if none)
+		std::vector<int> _output;
+		std::vector<int> _outputLink;
+	};
+
+	inline simpleStringMatcher::simpleStringMatcher(const simpleArray<simpleString>& patterns)
+	{
+		if (patterns.count() == 0)
+			throw simpleException("simpleStringMatcher must have at least one pattern:  simpleStringMatcher.h");
+
+		// Character classes
+		std::memset(_classes, 0, sizeof(_classes));
+
+		_classCount = 1;
+
+		for (int patternIndex = 0; patternIndex < patterns.count(); patternIndex++)
+		{
+			const simpleString& pattern = patterns.get(patternIndex);
+
+			if (pattern.count() == 0)
+				throw simpleException("Trying to search for zero-count string:  simpleStringMatcher");
+
+			for (int index = 0; index < pattern.count(); index++)
+			{
+				unsigned char character = (unsigned char)pattern.get(index);
+
+				if (_classes[character] == 0)
+					_classes[character] = _classCount++;
+			}
+
+			_patterns.push_back(pattern);
+		}
+
+		// Trie (-1 is no edge yet)
+		_transitions.assign(_classCount, -1);
+		_depth.push_back(0);
+		_output.push_back(-1);
+
+		for (int patternIndex = 0; patternIndex < (int)_patterns.size(); patternIndex++)
+		{
+			const simpleString& pattern = _patterns[patternIndex];
+			int state = 0;
+
+			for (int index = 0; index < pattern.count(); index++)
+			{
+				int characterClass = _classes[(unsigned char)pattern.get(index)];
+				int next = _transitions[state * _classCount + characterClass];
+
+				if (next < 0)
+				{
+					next = (int)_depth.size();
+
+					_transitions[state * _classCount + characterClass] = next;
+					_transitions.resize(_transitions.size() + _classCount, -1);
+					_depth.push_back(_depth[state] + 1);
+					_output.push_back(-1);
+				}
+
+				state = next;
+			}
+
+			// (Duplicates:  the first pattern is reported)
+			if (_output[state] < 0)
+				_output[state] = patternIndex;
+		}
+
+		// Failure links (breadth first); completing the DFA as the states are visited
+		int stateCount = (int)_depth.size();
+
+		std::vector<int> failure(stateCount, 0);
+		std::vector<int> queue;
+
+		_outputLink.assign(stateCount, -1);
+
+		queue.reserve(stateCount);
+
+		for (int characterClass = 0; characterClass < _classCount; characterClass++)
+		{
+			int next = _transitions[characterClass];
+
+			if (next < 0)
+				_transitions[characterClass] = 0;
+			else
+			{
+				failure[next] = 0;
+				queue.push_back(next);
+			}
+		}
+
+		for (int queueIndex = 0; queueIndex < (int)queue.size(); queueIndex++)
+		{
+			int state = queue[queueIndex];
+
+			// Nearest suffix state (on the failure chain) that ends a pattern
+			int fallback = failure[state];
+
+			_outputLink[state] = (_output[fallback] >= 0) ? fallback : _outputLink[fallback];
+
+			for (int characterClass = 0; characterClass < _classCount; characterClass++)
+			{
+				int next = _transitions[state * _classCount + characterClass];
+
+				if (next < 0)
+					_transitions[state * _classCount + characterClass] = _transitions[fallback * _classCount + characterClass];
+				else
+				{
+					failure[next] = _transitions[fallback * _classCount + characterClass];
+					queue.push_back(next);
+				}
+			}
+		}
+	}
+
+	inline int simpleStringMatcher::getPatternCount() const
+	{
+		return (int)_patterns.size();
+	}
+
+	inline const simpleString& simpleStringMatcher::getPattern(int patternIndex) const
+	{
+		if (patternIndex < 0 || patternIndex >= (int)_patterns.size())
+			throw simpleException("Index outside the bounds of the patterns:  simpleStringMatcher::getPattern");
+
+		return _patterns[patternIndex];
+	}
+
+	inline int simpleStringMatcher::transition(int state, char character) const
+	{
+		return _transitions[state * _classCount + _classes[(unsigned char)character]];
+	}
+
+	inline void simpleStringMatcher::forEachMatch(const simpleStringView& text, const simpleStringMatchCallback& callback) const
+	{
+		const char* chars = text.getChars();
+		int state = 0;
+
+		for (int index = 0; index < text.count(); index++)
+		{
+			state = this->transition(state, chars[index]);
+
+			int match = (_output[state] >= 0) ? state : _outputLink[state];
+
+			while (match >= 0)
+			{
+				if (callback(_output[match], index - _depth[match] + 1) == iterationCallback::breakAndReturn)
+					return;
+
+				match = _outputLink[match];
+			}
+		}
+	}
+
+	inline void simpleStringMatcher::forEachLeftmostMatch(const simpleStringView& text, const simpleStringMatchCallback& callback) const
+	{
+		const char* chars = text.getChars();
+		int count = text.count();
+		int state = 0;
+
+		// End of the last reported match (later matches may not start before it)
+		int reportedEnd = 0;
+
+		// Matches that may still be reported:  the best (leftmost; then longest) is on top. A match
+		// that loses to the best is kept - it is reported if it starts after the best ends.
+		std::priority_queue<candidate, std::vector<candidate>, candidateOrder> candidates;
+
+		for (int index = 0; index <= count; index++)
+		{
+			// (The last pass only flushes the candidates)
+			int progressIndex = index;
+
+			if (index < count)
+			{
+				state = this->transition(state, chars[index]);
+
+				for (int match = (_output[state] >= 0) ? state : _outputLink[state]; match >= 0; match = _outputLink[match])
+				{
+					int matchIndex = index - _depth[match] + 1;
+
+					if (matchIndex >= reportedEnd)
+						candidates.push(candidate{ matchIndex, _depth[match], _output[match] });
+				}
+
+				// First index where a match in progress could start (the state is the longest one)
+				progressIndex = index + 1 - _depth[state];
+			}
+
+			// Report the best while no later match can start at (or before) its index
+			while (!candidates.empty() && candidates.top().index < progressIndex)
+			{
+				candidate best = candidates.top();
+
+				if (callback(best.patternIndex, best.index) == iterationCallback::breakAndReturn)
+					return;
+
+				reportedEnd = best.index + best.length;
+
+				// Drop the overlapped candidates
+				while (!candidates.empty() && candidates.top().index < reportedEnd)
+					candidates.pop();
+			}
+		}
+	}
+
+	inline int simpleStringMatcher::indexOf(const simpleStringView& text, int& patternIndex) const
+	{
+		int result = -1;
+
+		patternIndex = -1;
+
+		this->forEachLeftmostMatch(text, [&result, &patternIndex] (int matchPattern, int index)
+		{
+			result = index;
+			patternIndex = matchPattern;
+
+			return iterationCallback::breakAndReturn;
+		});
+
+		return result;
+	}
+
+	inline bool simpleStringMatcher::containsAny(const simpleStringView& text) const
+	{
+		bool result = false;
+
+		this->forEachMatch(text, [&result] (int, int)
+		{
+			result = true;
+
+			return iterationCallback::breakAndReturn;
+		});
+
+		return result;
+	}
+
+	inline simpleString simpleStringMatcher::replaceAll(const simpleStringView& text, const simpleArray<simpleString>& replacements) const
+	{
+		if (replacements.count() != (int)_patterns.size())
+			throw simpleException("There must be one replacement per pattern:  simpleStringMatcher::replaceAll");
+
+		// Matches (index, pattern); and the size of the result
+		std::vector<candidate> matches;
+		long long resultCount = text.count();
+
+		this->forEachLeftmostMatch(text, [this, &matches, &replacements, &resultCount] (int patternIndex, int index)
+		{
+			matches.push_back(candidate{ index, _patterns[patternIndex].count(), patternIndex });
+
+			resultCount += replacements.get(patternIndex).count() - _patterns[patternIndex].count();
+
+			return iterationCallback::iterate;
+		});
+
+		simpleString result;
+
+		result.reserve((int)resultCount);
+
+		int readIndex = 0;
+
+		for (int index = 0; index < (int)matches.size(); index++)
+		{
+			result.append(text.getChars() + readIndex, matches[index].index - readIndex);
+			result.append(replacements.get(matches[index].patternIndex));
+
+			readIndex = matches[index].index + matches[index].length;
+		}
+
+		result.append(text.getChars() + readIndex, text.count() - readIndex);
+
+		return result;
+	}
+}
@@ -0,0 +1,383 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleStringView.h"
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace simple
+{
+	class simpleStringPool;
+
+	/// <summary>
+	/// Handle to a string interned by a simpleStringPool (one pointer). Atoms of the same pool are
+	/// equal exactly when their strings are equal; so equality is a pointer compare, and the hash is
+	/// stored with the characters (equal to simpleString::getHash() for the same text; and seeded
+	/// hashes equal simpleString::getHash(seed) - see simpleHashStdKey::seededHash). Atoms are
+	/// valid until their pool is cleared or destroyed; and atoms of different pools never compare
+	/// equal. The default atom is the empty (null) atom.
+	/// </summary>
+	class simpleAtom
+	{
+	public:
+
+		simpleAtom();
+
+		bool operator==(const simpleAtom& other) const;
+		bool operator!=(const simpleAtom& other) const;
+
+		/// <summary>
+		/// True for the default atom (not from a pool)
+		/// </summary>
+		bool isNull() const;
+
+		int count() const;
+
+		/// <summary>
+		/// Null terminated characters (stored in the pool)
+		/// </summary>
+		const char* c_str() const;
+
+		simpleStringView getView() const;
+
+		operator simpleStringView() const;
+
+		size_t getHash() const;
+		size_t getHash(size_t seed) const;
+
+	private:
+
+		friend class simpleStringPool;
+
+		struct entry
+		{
+			size_t hash;
+			int count;
+
+			// (Characters follow the entry; null terminated)
+			const char* getChars() const { return (const char*)(this + 1); }
+		};
+
+		simpleAtom(const entry* target);
+
+	private:
+
+		const entry* _entry;
+	};
+
+	/*
+		String Pool:  Interns strings into an arena; and hands out simpleAtom handles
+
+		- Each distinct string is stored once:  hash, count, and characters in one arena record. The
+		  arena is a list of large blocks (never moved); so atoms stay valid as the pool grows.
+		- Lookup is an open addressing table of record pointers (linear probing; at most half full).
+		  Probes compare the stored hash before the characters; so an intern is one hash of the text
+		  and (usually) one compare.
+		- Not thread safe:  Intern up front (or under a lock); atoms may then be used from any thread.
+	*/
+	class simpleStringPool
+	{
+	public:
+
+		/// <summary>
+		/// Size of one arena block (bytes; longer strings get a block of their own)
+		/// </summary>
+		static constexpr int BlockSize = 64 * 1024;
+
+	public:
+
+		simpleStringPool();
+		~simpleStringPool();
+
+		simpleStringPool(const simpleStringPool& copy) = delete;
+		void operator=(const simpleStringPool& copy) = delete;
+
+		/// <summary>
+		/// Returns the atom for the text (adding it to the pool the first time)
+		/// </summary>
+		simpleAtom intern(const simpleStringView& text);
+
+		/// <summary>
+		/// Returns false if the text has not been interned (nothing is added)
+		/// </summary>
+		bool tryGet(const simpleStringView& text, simpleAtom& atom) const;
+
+		bool contains(const simpleStringView& text) const;
+
+		/// <summary>
+		/// Number of distinct strings
+		/// </summary>
+		int count() const;
+
+		/// <summary>
+		/// Bytes held by the arena and lookup table
+		/// </summary>
+		size_t getMemoryUsage() const;
+
+		/// <summary>
+		/// Removes every string (invalidates all atoms of this pool)
+		/// </summary>
+		void clear();
+
+	private:
+
+		using entry = simpleAtom::entry;
+
+		/// <summary>
+		/// Slot of the text in the table:  its entry; or the empty slot where it would go
+		/// </summary>
+		int findSlot(const char* chars, int count, size_t hash) const;
+
+		entry* allocate(const char* chars, int count, size_t hash);
+
+		void rehash(int capacity);
+
+	private:
+
+		struct block
+		{
+			char* data;
+			size_t used;
+			size_t capacity;
+		};
+
+		// (MEMORY!) Arena blocks (owned by the pool)
+		std::vector<block> _blocks;
+
+		// Open addressing table (power of two; nullptr = empty)
+		std::vector<entry*> _table;
+
+		int _count;
+	};
+
+	inline simpleAtom::simpleAtom()
+	{
+		_entry = nullptr;
+	}
+
+	inline simpleAtom::simpleAtom(const entry* target)
+	{
+		_entry = target;
+	}
+
+	inline bool simpleAtom::operator==(const simpleAtom& other) const
+	{
+		return _entry == other._entry;
+	}
+
+	inline bool simpleAtom::operator!=(const simpleAtom& other) const
+	{
+		return _entry != other._entry;
+	}
+
+	inline bool simpleAtom::isNull() const
+	{
+		return _entry == nullptr;
+	}
+
+	inline int simpleAtom::count() const
+	{
+		return (_entry == nullptr) ? 0 : _entry->count;
+	}
+
+	inline const char* simpleAtom::c_str() const
+	{
+		return (_entry == nullptr) ? "" : _entry->getChars();
+	}
+
+	inline simpleStringView simpleAtom::getView() const
+	{
+		return simpleStringView(this->c_str(), this->count());
+	}
+
+	inline simpleAtom::operator simpleStringView() const
+	{
+		return this->getView();
+	}
+
+	inline size_t simpleAtom::getHash() const
+	{
+		return (_entry == nullptr) ? 0 : _entry->hash;
+	}
+
+	inline size_t simpleAtom::getHash(size_t seed) const
+	{
+		// (The stored hash is unseeded:  hash the characters)
+		return hashGenerator::generateBytesHash(this->c_str(), this->count(), seed);
+	}
+
+	inline simpleStringPool::simpleStringPool()
+	{
+		_count = 0;
+		_table.resize(64, nullptr);
+	}
+
+	inline simpleStringPool::~simpleStringPool()
+	{
+		this->clear();
+	}
+
+	inline int simpleStringPool::findSlot(const char* chars, int count, size_t hash) const
+	{
+		int mask = (int)_table.size() - 1;
+		int slot = (int)(hash & (size_t)mask);
+
+		// (The table is never full)
+		while (true)
+		{
+			const entry* target = _table[slot];
+
+			if (target == nullptr)
+				return slot;
+
+			if (target->hash == hash && target->count == count && std::memcmp(target->getChars(), chars, count) == 0)
+				return slot;
+
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	inline simpleAtom simpleStringPool::intern(const simpleStringView& text)
+	{
+		size_t hash = hashGenerator::generateBytesHash(text.getChars(), text.count());
+
+		int slot = this->findSlot(text.getChars(), text.count(), hash);
+
+		if (_table[slot] != nullptr)
+			return simpleAtom(_table[slot]);
+
+		// Keep the table at most half full
+		if ((_count + 1) * 2 > (int)_table.size())
+		{
+			this->rehash((int)_table.size() * 2);
+
+			slot = this->findSlot(text.getChars(), text.count(), hash);
+		}
+
+		entry* result = this->allocate(text.getChars(), text.count(), hash);
+
+		_table[slot] = result;
+		_count++;
+
+		return simpleAtom(result);
+	}
+
+	inline bool simpleStringPool::tryGet(const simpleStringView& text, simpleAtom& atom) const
+	{
+		size_t hash = hashGenerator::generateBytesHash(text.getChars(), text.count());
+
+		int slot = this->findSlot(text.getChars(), text.count(), hash);
+
+		if (_table[slot] == nullptr)
+			return false;
+
+		atom = simpleAtom(_table[slot]);
+
+		return true;
+	}
+
+	inline bool simpleStringPool::contains(const simpleStringView& text) const
+	{
+		simpleAtom atom;
+
+		return this->tryGet(text, atom);
+	}
+
+	inline simpleStringPool::entry* simpleStringPool::allocate(const char* chars, int count, size_t hash)
+	{
+		// Record:  entry + characters + terminator (rounded up to keep the next entry aligned)
+		size_t size = (sizeof(entry) + count + 1 + alignof(entry) - 1) & ~(alignof(entry) - 1);
+
+		char* storage;
+
+		// Long string:  Block of its own (kept behind the current block; so its free space is not lost)
+		if (size > (size_t)BlockSize)
+		{
+			// (MEMORY!)
+			_blocks.push_back(block{ new char[size], size, size });
+
+			storage = _blocks.back().data;
+
+			if (_blocks.size() > 1)
+				std::swap(_blocks[_blocks.size() - 1], _blocks[_blocks.size() - 2]);
+		}
+		else
+		{
+			if (_blocks.empty() || _blocks.back().capacity - _blocks.back().used < size)
+			{
+				// (MEMORY!) (operator new[] storage is aligned for entry)
+				_blocks.push_back(block{ new char[BlockSize], 0, (size_t)BlockSize });
+			}
+
+			block& target = _blocks.back();
+
+			storage = target.data + target.used;
+			target.used += size;
+		}
+
+		entry* result = new (storage) entry();
+
+		result->hash = hash;
+		result->count = count;
+
+		char* resultChars = (char*)(result + 1);
+
+		std::memcpy(resultChars, chars, count);
+		resultChars[count] = '\0';
+
+		return result;
+	}
+
+	inline void simpleStringPool::rehash(int capacity)
+	{
+		std::vector<entry*> table(capacity, nullptr);
+
+		int mask = capacity - 1;
+
+		for (int index = 0; index < (int)_table.size(); index++)
+		{
+			entry* target = _table[index];
+
+			if (target == nullptr)
+				continue;
+
+			int slot = (int)(target->hash & (size_t)mask);
+
+			while (table[slot] != nullptr)
+				slot = (slot + 1) & mask;
+
+			table[slot] = target;
+		}
+
+		_table.swap(table);
+	}
+
+	inline int simpleStringPool::count() const
+	{
+		return _count;
+	}
+
+	inline size_t simpleStringPool::getMemoryUsage() const
+	{
+		size_t result = _table.size() * sizeof(entry*);
+
+		for (int index = 0; index < (int)_blocks.size(); index++)
+			result += _blocks[index].capacity;
+
+		return result;
+	}
+
+	inline void simpleStringPool::clear()
+	{
+		// (MEMORY!)
+		for (int index = 0; index < (int)_blocks.size(); index++)
+			delete[] _blocks[index].data;
+
+		_blocks.clear();
+
+		_table.assign(64, nullptr);
+		_count = 0;
+	}
+}
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include "simpleStringView.h"
+#include <cstring>
+#include <vector>
+
+namespace simple
+{
+	/*
+		String Search:  Single pattern search over character ranges (used by simpleString)
+
+		- indexOf scans for the first character with memchr (vectorized in the C runtime); and checks
+		  the last character before comparing the rest. Candidates that fail verification are counted;
+		  and when they cost more than a few passes over the text (e.g. "aaa...ab" in "aaa...a"), the
+		  search finishes with Knuth-Morris-Pratt - so the worst case stays O(n + m).
+		- lastIndexOf scans backwards (first / last character check; then compare)
+
+		https://en.wikipedia.org/wiki/Knuth%E2%80%93Morris%E2%80%93Pratt_algorithm
+	*/
+	class simpleStringSearch
+	{
+	public:
+
+		/// <summary>
+		/// Index of the first match at (or after) the start index; or -1
+		/// </summary>
+		static int indexOf(const simpleStringView& text, const simpleStringView& pattern, int startIndex = 0)
+		{
+			if (pattern.count() == 0)
+				throw simpleException("Trying to search for zero-count string:  simpleStringSearch::indexOf");
+
+			if (startIndex < 0)
+				startIndex = 0;
+
+			const char* chars = text.getChars();
+			const char* patternChars = pattern.getChars();
+			int count = text.count();
+			int patternCount = pattern.count();
+
+			if (patternCount > count - startIndex)
+				return -1;
+
+			char first = patternChars[0];
+			char last = patternChars[patternCount - 1];
+
+			// Last possible start (inclusive)
+			int lastStart = count - patternCount;
+			int index = startIndex;
+
+			// Characters compared by failed verifications
+			long long verifyCost = 0;
+
+			while (index <= lastStart)
+			{
+				const char* found = (const char*)std::memchr(chars + index, first, lastStart - index + 1);
+
+				if (found == nullptr)
+					return -1;
+
+				index = (int)(found - chars);
+
+				if (chars[index + patternCount - 1] == last &&
+					std::memcmp(chars + index + 1, patternChars + 1, simpleMath::maxOf(patternCount - 2, 0)) == 0)
+					return index;
+
+				verifyCost += patternCount;
+
+				// Degenerate text / pattern:  Finish in linear time
+				if (verifyCost > 4LL * (count - startIndex) + patternCount)
+					return searchKMP(text, pattern, index + 1);
+
+				index++;
+			}
+
+			return -1;
+		}
+
+		/// <summary>
+		/// Index of the last match starting at (or before) the start index; or -1
+		/// </summary>
+		static int lastIndexOf(const simpleStringView& text, const simpleStringView& pattern, int startIndex)
+		{
+			if (pattern.count() == 0)
+				throw simpleException("Trying to search for zero-count string:  simpleStringSearch::lastIndexOf");
+
+			const char* chars = text.getChars();
+			const char* patternChars = pattern.getChars();
+			int patternCount = pattern.count();
+
+			char first = patternChars[0];
+			char last = patternChars[patternCount - 1];
+
+			for (int index = simpleMath::minOf(startIndex, text.count() - patternCount); index >= 0; index--)
+			{
+				if (chars[index] == first &&
+					chars[index + patternCount - 1] == last &&
+					std::memcmp(chars + index, patternChars, patternCount) == 0)
+					return index;
+			}
+
+			return -1;
+		}
+
+		static int lastIndexOf(const simpleStringView& text, const simpleStringView& pattern)
+		{
+			return lastIndexOf(text, pattern, text.count());
+		}
+
+		/// <summary>
+		/// Number of (non-overlapping) matches
+		/// </summary>
+		static int countOf(const simpleStringView& text, const simpleStringView& pattern)
+		{
+			int result = 0;
+			int index = indexOf(text, pattern, 0);
+
+			while (index >= 0)
+			{
+				result++;
+				index = indexOf(text, pattern, index + pattern.count());
+			}
+
+			return result;
+		}
+
+	private:
+
+		static int searchKMP(const simpleStringView& text, const simpleStringView& pattern, int startIndex)
+		{
+			const char* chars = text.getChars();
+			const char* patternChars = pattern.getChars();
+			int patternCount = pattern.count();
+
+			// (MEMORY!) Failure function:  Length of the longest proper border of pattern[0, index]
+			std::vector<int> border(patternCount, 0);
+
+			for (int index = 1, length = 0; index < patternCount; index++)
+			{
+				while (length > 0 && patternChars[index] != patternChars[length])
+					length = border[length - 1];
+
+				if (patternChars[index] == patternChars[length])
+					length++;
+
+				border[index] = length;
+			}
+
+			for (int index = startIndex, matched = 0; index < text.count(); index++)
+			{
+				while (matched > 0 && chars[index] != patternChars[matched])
+					matched = border[matched - 1];
+
+				if (chars[index] == patternChars[matched])
+					matched++;
+
+				if (matched == patternCount)
+					return index - patternCount + 1;
+			}
+
+			return -1;
+		}
+	};
+}
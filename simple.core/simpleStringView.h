@@ -0,0 +1,232 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include <cctype>
+#include <cstring>
+
+namespace simple
+{
+	/// <summary>
+	/// Non-owning view of a character range (pointer + count). The characters are not copied, and
+	/// are not null terminated - the view must not outlive the string it was taken from. Hashes the
+	/// same as a simpleString with the same characters; so it may be used to look one up.
+	/// </summary>
+	class simpleStringView
+	{
+	public:
+
+		simpleStringView();
+		simpleStringView(const char* chars);
+		simpleStringView(const char* chars, int count);
+
+		bool operator==(const simpleStringView& other) const;
+		bool operator!=(const simpleStringView& other) const;
+		bool operator==(const char* other) const;
+		bool operator!=(const char* other) const;
+
+		char get(int index) const;
+		int count() const;
+		bool isEmpty() const;
+
+		/// <summary>
+		/// Pointer to the first character (not null terminated)
+		/// </summary>
+		const char* getChars() const;
+
+		simpleStringView subView(int index, int count) const;
+
+		bool startsWith(const simpleStringView& other) const;
+		bool endsWith(const simpleStringView& other) const;
+
+		/// <summary>
+		/// Removes leading / trailing white space (returns a narrower view)
+		/// </summary>
+		simpleStringView trim() const;
+
+	public:
+
+		size_t getHash() const;
+		size_t getHash(size_t seed) const;
+
+	private:
+
+		const char* _chars;
+		int _count;
+	};
+
+	/// <summary>
+	/// Lazy tokenizer:  Returns the views between delimiter characters (empty tokens are skipped);
+	/// one per call to next(...). Nothing is allocated.
+	/// </summary>
+	class simpleStringTokenizer
+	{
+	public:
+
+		simpleStringTokenizer(const simpleStringView& text, const char* delimiters);
+
+		/// <summary>
+		/// Sets the next token; and returns false when there are no more
+		/// </summary>
+		bool next(simpleStringView& token);
+
+	private:
+
+		simpleStringView _text;
+
+		int _position;
+
+		// Delimiter lookup (by unsigned character)
+		bool _delimiters[256];
+	};
+
+	inline simpleStringView::simpleStringView()
+	{
+		_chars = "";
+		_count = 0;
+	}
+
+	inline simpleStringView::simpleStringView(const char* chars)
+	{
+		if (chars == nullptr)
+			throw simpleException("Trying to declare simpleStringView from nullptr:  simpleStringView.h");
+
+		_chars = chars;
+		_count = (int)strlen(chars);
+	}
+
+	inline simpleStringView::simpleStringView(const char* chars, int count)
+	{
+		if (count < 0 || (chars == nullptr && count > 0))
+			throw simpleException("Invalid character range:  simpleStringView.h");
+
+		_chars = (chars == nullptr) ? "" : chars;
+		_count = count;
+	}
+
+	inline bool simpleStringView::operator==(const simpleStringView& other) const
+	{
+		return _count == other.count() && std::memcmp(_chars, other.getChars(), _count) == 0;
+	}
+
+	inline bool simpleStringView::operator!=(const simpleStringView& other) const
+	{
+		return !(*this == other);
+	}
+
+	inline bool simpleStringView::operator==(const char* other) const
+	{
+		if (other == nullptr)
+			return false;
+
+		// Also checks that the other ends here
+		return strnlen_s(other, _count + 1) == (size_t)_count && std::memcmp(_chars, other, _count) == 0;
+	}
+
+	inline bool simpleStringView::operator!=(const char* other) const
+	{
+		return !(*this == other);
+	}
+
+	inline char simpleStringView::get(int index) const
+	{
+		if (index < 0 || index >= _count)
+			throw simpleException("Index outside the bounds of the view:  simpleStringView::get");
+
+		return _chars[index];
+	}
+
+	inline int simpleStringView::count() const
+	{
+		return _count;
+	}
+
+	inline bool simpleStringView::isEmpty() const
+	{
+		return _count == 0;
+	}
+
+	inline const char* simpleStringView::getChars() const
+	{
+		return _chars;
+	}
+
+	inline simpleStringView simpleStringView::subView(int index, int count) const
+	{
+		if (index < 0 || count < 0 || index + count > _count)
+			throw simpleException("Index outside the bounds of the view:  simpleStringView::subView");
+
+		return simpleStringView(_chars + index, count);
+	}
+
+	inline bool simpleStringView::startsWith(const simpleStringView& other) const
+	{
+		return other.count() <= _count && std::memcmp(_chars, other.getChars(), other.count()) == 0;
+	}
+
+	inline bool simpleStringView::endsWith(const simpleStringView& other) const
+	{
+		return other.count() <= _count && std::memcmp(_chars + _count - other.count(), other.getChars(), other.count()) == 0;
+	}
+
+	inline simpleStringView simpleStringView::trim() const
+	{
+		int lowIndex = 0;
+		int highIndex = _count;
+
+		while (lowIndex < highIndex && isspace((unsigned char)_chars[lowIndex]))
+			lowIndex++;
+
+		while (highIndex > lowIndex && isspace((unsigned char)_chars[highIndex - 1]))
+			highIndex--;
+
+		return simpleStringView(_chars + lowIndex, highIndex - lowIndex);
+	}
+
+	inline size_t simpleStringView::getHash() const
+	{
+		// (Must match simpleString::getHash())
+		return hashGenerator::generateBytesHash(_chars, _count);
+	}
+
+	inline size_t simpleStringView::getHash(size_t seed) const
+	{
+		return hashGenerator::generateBytesHash(_chars, _count, seed);
+	}
+
+	inline simpleStringTokenizer::simpleStringTokenizer(const simpleStringView& text, const char* delimiters)
+		: _text(text)
+	{
+		if (delimiters == nullptr)
+			throw simpleException("Trying to tokenize with nullptr delimiters:  simpleStringView.h");
+
+		_position = 0;
+
+		std::memset(_delimiters, 0, sizeof(_delimiters));
+
+		for (const char* delimiter = delimiters; *delimiter != '\0'; delimiter++)
+			_delimiters[(unsigned char)*delimiter] = true;
+	}
+
+	inline bool simpleStringTokenizer::next(simpleStringView& token)
+	{
+		const char* chars = _text.getChars();
+		int count = _text.count();
+
+		// Skip delimiters (empty tokens)
+		while (_position < count && _delimiters[(unsigned char)chars[_position]])
+			_position++;
+
+		if (_position >= count)
+			return false;
+
+		int start = _position;
+
+		while (_position < count && !_delimiters[(unsigned char)chars[_position]])
+			_position++;
+
+		token = simpleStringView(chars + start, _position - start);
+
+		return true;
+	}
+}
@@ -0,0 +1,452 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleExt.h"
+#include "simpleList.h"
+#include "simpleString.h"
+#include "simpleStringView.h"
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+
+namespace simple
+{
+	/// <summary>
+	/// Callback for each line of simpleTextReader::forEachLine (line numbers start at 1). The view is
+	/// valid during the call only.
+	/// </summary>
+	using simpleTextReaderCallback = std::function<iterationCallback(const simpleStringView& line, int lineNumber)>;
+
+	/// <summary>
+	/// UTF-8 validation / decoding (RFC 3629:  no overlong forms, surrogates, or code points above
+	/// U+10FFFF). ASCII runs are skipped 8 bytes at a time.
+	/// </summary>
+	class simpleUtf8
+	{
+	public:
+
+		/// <summary>
+		/// Returns false if the text is not valid UTF-8; and sets the error index to the first byte of
+		/// the invalid sequence
+		/// </summary>
+		static bool isValid(const simpleStringView& text, int& errorIndex)
+		{
+			const unsigned char* chars = (const unsigned char*)text.getChars();
+			int count = text.count();
+			int index = 0;
+
+			errorIndex = -1;
+
+			while (index < count)
+			{
+				// ASCII:  No high bits in the next 8 bytes
+				while (index + 8 <= count)
+				{
+					uint64_t word;
+
+					std::memcpy(&word, chars + index, 8);
+
+					if ((word & 0x8080808080808080ull) != 0)
+						break;
+
+					index += 8;
+				}
+
+				if (index >= count)
+					break;
+
+				if (chars[index] < 0x80)
+				{
+					index++;
+					continue;
+				}
+
+				int length = sequenceLength(chars + index, count - index);
+
+				if (length == 0)
+				{
+					errorIndex = index;
+					return false;
+				}
+
+				index += length;
+			}
+
+			return true;
+		}
+
+		static bool isValid(const simpleStringView& text)
+		{
+			int errorIndex;
+
+			return isValid(text, errorIndex);
+		}
+
+		/// <summary>
+		/// Decodes the code point at the index; and moves the index past it. Returns false at the end
+		/// of the text, or for an invalid sequence (the index is not moved).
+		/// </summary>
+		static bool decode(const simpleStringView& text, int& index, char32_t& codePoint)
+		{
+			if (index < 0 || index >= text.count())
+				return false;
+
+			const unsigned char* chars = (const unsigned char*)text.getChars() + index;
+
+			int length = (chars[0] < 0x80) ? 1 : sequenceLength(chars, text.count() - index);
+
+			switch (length)
+			{
+			case 1:
+				codePoint = chars[0];
+				break;
+			case 2:
+				codePoint = ((chars[0] & 0x1F) << 6) | (chars[1] & 0x3F);
+				break;
+			case 3:
+				codePoint = ((chars[0] & 0x0F) << 12) | ((chars[1] & 0x3F) << 6) | (chars[2] & 0x3F);
+				break;
+			case 4:
+				codePoint = ((chars[0] & 0x07) << 18) | ((chars[1] & 0x3F) << 12) | ((chars[2] & 0x3F) << 6) | (chars[3] & 0x3F);
+				break;
+			default:
+				return false;
+			}
+
+			index += length;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Number of code points (throws for invalid UTF-8)
+		/// </summary>
+		static int countCodePoints(const simpleStringView& text)
+		{
+			int errorIndex;
+
+			if (!isValid(text, errorIndex))
+				throw simpleException(simpleExt::format("Invalid UTF-8 at index {}:  simpleUtf8::countCodePoints", errorIndex));
+
+			// Every byte that is not a continuation byte starts a code point
+			int result = 0;
+
+			for (int index = 0; index < text.count(); index++)
+			{
+				if (((unsigned char)text.getChars()[index] & 0xC0) != 0x80)
+					result++;
+			}
+
+			return result;
+		}
+
+	private:
+
+		/// <summary>
+		/// Length of the (multi-byte) sequence at the start of the characters; or 0 if it is invalid
+		/// </summary>
+		static int sequenceLength(const unsigned char* chars, int remaining)
+		{
+			unsigned char lead = chars[0];
+
+			auto isContinuation = [](unsigned char next) { return (next & 0xC0) == 0x80; };
+
+			// (0x80 - 0xC1:  continuation bytes; and overlong 2-byte forms)
+			if (lead < 0xC2)
+				return 0;
+
+			if (lead < 0xE0)
+				return (remaining >= 2 && isContinuation(chars[1])) ? 2 : 0;
+
+			if (lead < 0xF0)
+			{
+				if (remaining < 3)
+					return 0;
+
+				// E0:  no overlong forms; ED:  no surrogates (U+D800 - U+DFFF)
+				unsigned char low = (lead == 0xE0) ? 0xA0 : 0x80;
+				unsigned char high = (lead == 0xED) ? 0x9F : 0xBF;
+
+				return (chars[1] >= low && chars[1] <= high && isContinuation(chars[2])) ? 3 : 0;
+			}
+
+			if (lead < 0xF5)
+			{
+				if (remaining < 4)
+					return 0;
+
+				// F0:  no overlong forms; F4:  nothing above U+10FFFF
+				unsigned char low = (lead == 0xF0) ? 0x90 : 0x80;
+				unsigned char high = (lead == 0xF4) ? 0x8F : 0xBF;
+
+				return (chars[1] >= low && chars[1] <= high && isContinuation(chars[2]) && isContinuation(chars[3])) ? 4 : 0;
+			}
+
+			return 0;
+		}
+	};
+
+	/*
+		Text Reader:  Streams a text file line by line through a fixed block buffer
+
+		- The file is read in large blocks (binary; bufferSize bytes). Lines are returned as views
+		  into the buffer - nothing is copied - and are valid until the next read. A line longer than
+		  the buffer grows it (so the buffer only ever holds the longest line, plus one block).
+		- Line endings ("\n" or "\r\n") are removed; and a UTF-8 byte order mark is skipped.
+		- With UTF-8 validation on, each line is checked as it is read (see simpleUtf8); and an invalid
+		  line throws with its line / column.
+		- Memory use does not depend on the size of the file
+	*/
+	class simpleTextReader
+	{
+	public:
+
+		static constexpr int DefaultBufferSize = 1 << 20;
+
+	public:
+
+		simpleTextReader(const char* filename, bool validateUtf8 = false, int bufferSize = DefaultBufferSize);
+		simpleTextReader(const simpleString& filename, bool validateUtf8 = false, int bufferSize = DefaultBufferSize);
+		~simpleTextReader();
+
+		simpleTextReader(const simpleTextReader& copy) = delete;
+		void operator=(const simpleTextReader& copy) = delete;
+
+		/// <summary>
+		/// Sets the next line (without its line ending); and returns false at the end of the file
+		/// </summary>
+		bool readLine(simpleStringView& line);
+
+		/// <summary>
+		/// Reads the next line; and splits it on the delimiter into the (cleared) list (empty fields
+		/// are kept). Returns false at the end of the file.
+		/// </summary>
+		bool readFields(char delimiter, simpleList<simpleStringView>& fields);
+
+		/// <summary>
+		/// Calls the callback for each of the remaining lines (until it returns breakAndReturn)
+		/// </summary>
+		void forEachLine(const simpleTextReaderCallback& callback);
+
+		/// <summary>
+		/// Number of lines read
+		/// </summary>
+		int getLineNumber() const;
+
+		/// <summary>
+		/// Number of bytes read from the file
+		/// </summary>
+		long long getBytesRead() const;
+
+	private:
+
+		/// <summary>
+		/// Moves the unread characters to the front of the buffer (growing it if it is full); and
+		/// reads the next block. Returns false at the end of the file.
+		/// </summary>
+		bool fill();
+
+	private:
+
+		std::ifstream _stream;
+
+		// (MEMORY!) Block buffer:  Unread characters are [_start, _end)
+		char* _buffer;
+		int _capacity;
+		int _start;
+		int _end;
+
+		bool _endOfFile;
+		bool _validateUtf8;
+
+		int _lineNumber;
+		long long _bytesRead;
+	};
+
+	inline simpleTextReader::simpleTextReader(const char* filename, bool validateUtf8, int bufferSize)
+		: _stream(filename, std::ios::in | std::ios::binary)
+	{
+		if (bufferSize <= 0)
+			throw simpleException("Invalid buffer size:  simpleTextReader.h");
+
+		if (!_stream.is_open())
+			throw simpleException(simpleExt::format("Error trying to open file:  {}", filename));
+
+		_buffer = new char[bufferSize];
+		_capacity = bufferSize;
+		_start = 0;
+		_end = 0;
+		_endOfFile = false;
+		_validateUtf8 = validateUtf8;
+		_lineNumber = 0;
+		_bytesRead = 0;
+
+		// Skip the UTF-8 byte order mark
+		while (_end < 3 && this->fill())
+		{
+		}
+
+		if (_end >= 3 && std::memcmp(_buffer, "\xEF\xBB\xBF", 3) == 0)
+			_start = 3;
+	}
+
+	inline simpleTextReader::simpleTextReader(const simpleString& filename, bool validateUtf8, int bufferSize)
+		: simpleTextReader(filename.c_str(), validateUtf8, bufferSize)
+	{
+	}
+
+	inline simpleTextReader::~simpleTextReader()
+	{
+		// (MEMORY!)
+		delete[] _buffer;
+
+		_stream.close();
+	}
+
+	inline bool simpleTextReader::fill()
+	{
+		if (_endOfFile)
+			return false;
+
+		if (_start > 0)
+		{
+			std::memmove(_buffer, _buffer + _start, _end - _start);
+
+			_end -= _start;
+			_start = 0;
+		}
+
+		// Full buffer (one line):  Double it
+		if (_end == _capacity)
+		{
+			int capacity = (_capacity > INT_MAX / 2) ? INT_MAX : _capacity * 2;
+
+			if (capacity == _capacity)
+				throw simpleException("Line is too long for simpleTextReader:  simpleTextReader::fill");
+
+			// (MEMORY!)
+			char* buffer = new char[capacity];
+
+			std::memcpy(buffer, _buffer, _end);
+
+			delete[] _buffer;
+
+			_buffer = buffer;
+			_capacity = capacity;
+		}
+
+		_stream.read(_buffer + _end, _capacity - _end);
+
+		int readCount = (int)_stream.gcount();
+
+		_end += readCount;
+		_bytesRead += readCount;
+
+		if (!_stream)
+			_endOfFile = true;
+
+		return readCount > 0;
+	}
+
+	inline bool simpleTextReader::readLine(simpleStringView& line)
+	{
+		// Characters already searched for the line ending (from _start)
+		int searched = 0;
+		int lineEnd;
+		int nextStart;
+
+		while (true)
+		{
+			const char* found = (const char*)std::memchr(_buffer + _start + searched, '\n', _end - _start - searched);
+
+			if (found != nullptr)
+			{
+				lineEnd = (int)(found - _buffer);
+				nextStart = lineEnd + 1;
+				break;
+			}
+
+			searched = _end - _start;
+
+			if (!this->fill())
+			{
+				// Last line (no line ending)
+				if (_start == _end)
+					return false;
+
+				lineEnd = _end;
+				nextStart = _end;
+				break;
+			}
+		}
+
+		int lineStart = _start;
+
+		if (lineEnd > lineStart && _buffer[lineEnd - 1] == '\r')
+			lineEnd--;
+
+		line = simpleStringView(_buffer + lineStart, lineEnd - lineStart);
+
+		_start = nextStart;
+		_lineNumber++;
+
+		int errorIndex;
+
+		if (_validateUtf8 && !simpleUtf8::isValid(line, errorIndex))
+			throw simpleException(simpleExt::format("Invalid UTF-8 at line {} column {}:  simpleTextReader::readLine", _lineNumber, errorIndex + 1));
+
+		return true;
+	}
+
+	inline bool simpleTextReader::readFields(char delimiter, simpleList<simpleStringView>& fields)
+	{
+		simpleStringView line;
+
+		fields.clear();
+
+		if (!this->readLine(line))
+			return false;
+
+		const char* start = line.getChars();
+		const char* end = start + line.count();
+
+		while (true)
+		{
+			const char* found = (const char*)std::memchr(start, delimiter, end - start);
+
+			if (found == nullptr)
+			{
+				fields.add(simpleStringView(start, (int)(end - start)));
+				return true;
+			}
+
+			fields.add(simpleStringView(start, (int)(found - start)));
+
+			start = found + 1;
+		}
+	}
+
+	inline void simpleTextReader::forEachLine(const simpleTextReaderCallback& callback)
+	{
+		simpleStringView line;
+
+		while (this->readLine(line))
+		{
+			if (callback(line, _lineNumber) == iterationCallback::breakAndReturn)
+				return;
+		}
+	}
+
+	inline int simpleTextReader::getLineNumber() const
+	{
+		return _lineNumber;
+	}
+
+	inline long long simpleTextReader::getBytesRead() const
+	{
+		return _bytesRead;
+	}
+}
@@ -0,0 +1,361 @@
+#pragma once
+
+#include "simple.h"
+#include "simpleException.h"
+#include "simpleMath.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simple
+{
+	/// <summary>
+	/// Work for one chunk [lowIndex, highIndex) of a parallel loop
+	/// </summary>
+	using simpleThreadPoolRangeCallback = std::function<void(int chunkIndex, int lowIndex, int highIndex)>;
+
+	/*
+		Thread Pool:  Fixed set of worker threads with work-stealing
+
+		- Each worker owns a task deque:  it takes its own work from the back (LIFO - warm cache); and
+		  idle workers steal from the front of the other deques (oldest / largest work first).
+		- parallelFor splits [0, count) into chunks; and the calling thread runs chunks (of any deque)
+		  while it waits. So nested parallelFor calls from inside a task do not deadlock.
+		- The first exception thrown by a chunk is re-thrown on the calling thread (after all chunks
+		  have finished).
+
+		https://en.wikipedia.org/wiki/Work_stealing
+	*/
+	class simpleThreadPool
+	{
+	public:
+
+		/// <summary>
+		/// Smallest chunk that getChunkCount will create (items)
+		/// </summary>
+		static constexpr int MinChunkSize = 1024;
+
+		/// <summary>
+		/// Chunks per thread for getChunkCount (load balancing for uneven work)
+		/// </summary>
+		static constexpr int ChunksPerThread = 4;
+
+	public:
+
+		simpleThreadPool(int workerCount);
+		~simpleThreadPool();
+
+		simpleThreadPool(const simpleThreadPool& copy) = delete;
+		void operator=(const simpleThreadPool& copy) = delete;
+
+		/// <summary>
+		/// Shared pool (hardware threads - 1 workers; the calling thread is the last one)
+		/// </summary>
+		static simpleThreadPool& getDefault();
+
+		int getWorkerCount() const;
+
+		/// <summary>
+		/// Number of chunks to use for a loop of count items
+		/// </summary>
+		int getChunkCount(int count) const;
+
+		/// <summary>
+		/// Runs the callback for each of chunkCount (equal) chunks of [0, count); and returns when
+		/// they have all finished. Chunk i is [count * i / chunkCount, count * (i + 1) / chunkCount).
+		/// </summary>
+		void parallelFor(int count, int chunkCount, const simpleThreadPoolRangeCallback& callback);
+
+		/// <summary>
+		/// parallelFor using getChunkCount(count) chunks
+		/// </summary>
+		void parallelFor(int count, const simpleThreadPoolRangeCallback& callback);
+
+	private:
+
+		/// <summary>
+		/// Completion state for one parallelFor (lives on the caller's stack)
+		/// </summary>
+		struct taskGroup
+		{
+			std::atomic<int> pending;
+
+			std::mutex exceptionLock;
+			std::exception_ptr exception;
+		};
+
+		struct task
+		{
+			std::function<void()> work;
+			taskGroup* group;
+		};
+
+		struct alignas(simpleCacheLineSize) workerQueue
+		{
+			std::mutex lock;
+			std::deque<task> tasks;
+		};
+
+	private:
+
+		void workerLoop(int workerIndex);
+
+		void push(int queueIndex, task&& work);
+		bool tryPop(int queueIndex, task& work);
+		bool trySteal(int queueIndex, task& work);
+
+		/// <summary>
+		/// Runs one queued task (own queue first; then steals). Returns false if there was none.
+		/// </summary>
+		bool tryRunTask(int queueIndex);
+
+		void runTask(task& work);
+
+	private:
+
+		// Queue of the current thread (workers); or -1 (other threads)
+		static thread_local int CurrentQueueIndex;
+
+		// Worker queues; and one shared queue (last) for threads outside of the pool
+		std::unique_ptr<workerQueue[]> _queues;
+		int _queueCount;
+
+		std::vector<std::thread> _workers;
+
+		// Tasks waiting in the queues (wakes the workers)
+		std::atomic<int> _queuedCount;
+
+		// Round robin start queue for external submissions
+		std::atomic<unsigned int> _nextQueue;
+
+		std::mutex _sleepLock;
+		std::condition_variable _sleepCondition;
+		bool _shutdown;
+	};
+
+	inline thread_local int simpleThreadPool::CurrentQueueIndex = -1;
+
+	inline simpleThreadPool::simpleThreadPool(int workerCount)
+	{
+		if (workerCount < 1)
+			throw simpleException("Thread pool must have at least one worker:  simpleThreadPool.h");
+
+		_queueCount = workerCount + 1;
+		_queues = std::make_unique<workerQueue[]>(_queueCount);
+		_queuedCount = 0;
+		_nextQueue = 0;
+		_shutdown = false;
+
+		for (int index = 0; index < workerCount; index++)
+			_workers.emplace_back([this, index] () { this->workerLoop(index); });
+	}
+
+	inline simpleThreadPool::~simpleThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(_sleepLock);
+
+			_shutdown = true;
+		}
+
+		_sleepCondition.notify_all();
+
+		for (int index = 0; index < (int)_workers.size(); index++)
+			_workers[index].join();
+	}
+
+	inline simpleThreadPool& simpleThreadPool::getDefault()
+	{
+		static simpleThreadPool pool(simpleMath::maxOf((int)std::thread::hardware_concurrency() - 1, 1));
+
+		return pool;
+	}
+
+	inline int simpleThreadPool::getWorkerCount() const
+	{
+		return (int)_workers.size();
+	}
+
+	inline int simpleThreadPool::getChunkCount(int count) const
+	{
+		int maxChunks = (this->getWorkerCount() + 1) * ChunksPerThread;
+
+		return simpleMath::maxOf(simpleMath::minOf(count / MinChunkSize, maxChunks), 1);
+	}
+
+	inline void simpleThreadPool::parallelFor(int count, const simpleThreadPoolRangeCallback& callback)
+	{
+		this->parallelFor(count, this->getChunkCount(count), callback);
+	}
+
+	inline void simpleThreadPool::parallelFor(int count, int chunkCount, const simpleThreadPoolRangeCallback& callback)
+	{
+		if (count <= 0)
+			return;
+
+		chunkCount = simpleMath::maxOf(simpleMath::minOf(chunkCount, count), 1);
+
+		// Single chunk:  Nothing to share
+		if (chunkCount == 1)
+		{
+			callback(0, 0, count);
+			return;
+		}
+
+		taskGroup group;
+		group.pending = chunkCount;
+
+		// Workers queue their own chunks (stolen as needed); other threads spread them over the workers
+		int callerQueue = (CurrentQueueIndex >= 0) ? CurrentQueueIndex : _queueCount - 1;
+
+		// (Unsigned:  The counter wraps around)
+		unsigned int firstQueue = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+
+		// Chunk 0 is run by the caller below
+		for (int chunkIndex = chunkCount - 1; chunkIndex >= 1; chunkIndex--)
+		{
+			int lowIndex = (int)(((long long)count * chunkIndex) / chunkCount);
+			int highIndex = (int)(((long long)count * (chunkIndex + 1)) / chunkCount);
+
+			int queueIndex = (CurrentQueueIndex >= 0) ? CurrentQueueIndex : (int)((firstQueue + (unsigned int)chunkIndex) % (unsigned int)(_queueCount - 1));
+
+			this->push(queueIndex, task
+			{
+				[&callback, chunkIndex, lowIndex, highIndex] () { callback(chunkIndex, lowIndex, highIndex); },
+				&group
+			});
+		}
+
+		// Wake the workers (the lock orders this with a worker about to sleep)
+		{
+			std::lock_guard<std::mutex> lock(_sleepLock);
+		}
+
+		_sleepCondition.notify_all();
+
+		// Run chunk 0; then help until the group is finished
+		task first
+		{
+			[&callback, count, chunkCount] () { callback(0, 0, (int)((long long)count / chunkCount)); },
+			&group
+		};
+
+		this->runTask(first);
+
+		while (group.pending.load(std::memory_order_acquire) > 0)
+		{
+			if (!this->tryRunTask(callerQueue))
+				std::this_thread::yield();
+		}
+
+		if (group.exception)
+			std::rethrow_exception(group.exception);
+	}
+
+	inline void simpleThreadPool::workerLoop(int workerIndex)
+	{
+		CurrentQueueIndex = workerIndex;
+
+		while (true)
+		{
+			if (this->tryRunTask(workerIndex))
+				continue;
+
+			std::unique_lock<std::mutex> lock(_sleepLock);
+
+			_sleepCondition.wait(lock, [this] ()
+			{
+				return _shutdown || _queuedCount.load(std::memory_order_acquire) > 0;
+			});
+
+			if (_shutdown)
+				return;
+		}
+	}
+
+	inline void simpleThreadPool::push(int queueIndex, task&& work)
+	{
+		{
+			std::lock_guard<std::mutex> lock(_queues[queueIndex].lock);
+
+			_queues[queueIndex].tasks.push_back(std::move(work));
+		}
+
+		_queuedCount.fetch_add(1, std::memory_order_release);
+	}
+
+	inline bool simpleThreadPool::tryPop(int queueIndex, task& work)
+	{
+		std::lock_guard<std::mutex> lock(_queues[queueIndex].lock);
+
+		if (_queues[queueIndex].tasks.empty())
+			return false;
+
+		work = std::move(_queues[queueIndex].tasks.back());
+
+		_queues[queueIndex].tasks.pop_back();
+		_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	inline bool simpleThreadPool::trySteal(int queueIndex, task& work)
+	{
+		std::unique_lock<std::mutex> lock(_queues[queueIndex].lock, std::try_to_lock);
+
+		if (!lock.owns_lock() || _queues[queueIndex].tasks.empty())
+			return false;
+
+		work = std::move(_queues[queueIndex].tasks.front());
+
+		_queues[queueIndex].tasks.pop_front();
+		_queuedCount.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	inline bool simpleThreadPool::tryRunTask(int queueIndex)
+	{
+		if (_queuedCount.load(std::memory_order_acquire) == 0)
+			return false;
+
+		task work;
+
+		bool found = this->tryPop(queueIndex, work);
+
+		// Steal:  Start at the next queue (spreads the thieves over the victims)
+		for (int offset = 1; offset < _queueCount && !found; offset++)
+			found = this->trySteal((queueIndex + offset) % _queueCount, work);
+
+		if (found)
+			this->runTask(work);
+
+		return found;
+	}
+
+	inline void simpleThreadPool::runTask(task& work)
+	{
+		taskGroup* group = work.group;
+
+		try
+		{
+			work.work();
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(group->exceptionLock);
+
+			if (!group->exception)
+				group->exception = std::current_exception();
+		}
+
+		// (Last access to the group:  the caller may return once pending reaches zero)
+		group->pending.fetch_sub(1, std::memory_order_acq_rel);
+	}
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace simple
+{
+	/*
+		Bulk-byte hash for contiguous data (strings, arrays of plain values, buffers)
+
+		wyhash (final version 4) - https://github.com/wangyi-fudan/wyhash (public domain / unlicense)
+
+		The previous approach hashed one element at a time through hashGenerator::combineHash; which
+		meant a std::hash call plus a full mix for every character. This reads 8 / 16 / 48 bytes per
+		step; and finishes with a 64 x 64 -> 128 bit multiply-mix.
+	*/
+	class simpleWyHash
+	{
+	public:
+
+		/// <summary>
+		/// Default (unseeded) hash of the byte range. Deterministic across runs.
+		/// </summary>
+		static uint64_t hash(const void* data, size_t length)
+		{
+			return hash(data, length, 0);
+		}
+
+		/// <summary>
+		/// Seeded hash of the byte range. Use a per-process random seed for any table that
+		/// is keyed by outside (untrusted) input.
+		/// </summary>
+		static uint64_t hash(const void* data, size_t length, uint64_t seed)
+		{
+			const uint8_t* bytes = (const uint8_t*)data;
+			uint64_t a = 0;
+			uint64_t b = 0;
+
+			seed ^= mix(seed ^ Secret0, Secret1);
+
+			if (length <= 16)
+			{
+				if (length >= 4)
+				{
+					a = (read4(bytes) << 32) | read4(bytes + ((length >> 3) << 2));
+					b = (read4(bytes + length - 4) << 32) | read4(bytes + length - 4 - ((length >> 3) << 2));
+				}
+				else if (length > 0)
+				{
+					a = read3(bytes, length);
+					b = 0;
+				}
+			}
+			else
+			{
+				size_t remaining = length;
+
+				if (remaining > 48)
+				{
+					uint64_t seed1 = seed;
+					uint64_t seed2 = seed;
+
+					do
+					{
+						seed = mix(read8(bytes) ^ Secret1, read8(bytes + 8) ^ seed);
+						seed1 = mix(read8(bytes + 16) ^ Secret2, read8(bytes + 24) ^ seed1);
+						seed2 = mix(read8(bytes + 32) ^ Secret3, read8(bytes + 40) ^ seed2);
+
+						bytes += 48;
+						remaining -= 48;
+
+					} while (remaining > 48);
+
+					seed ^= seed1 ^ seed2;
+				}
+
+				while (remaining > 16)
+				{
+					seed = mix(read8(bytes) ^ Secret1, read8(bytes + 8) ^ seed);
+
+					bytes += 16;
+					remaining -= 16;
+				}
+
+				a = read8(bytes + remaining - 16);
+				b = read8(bytes + remaining - 8);
+			}
+
+			a ^= Secret1;
+			b ^= seed;
+
+			multiply(a, b);
+
+			return mix(a ^ Secret0 ^ length, b ^ Secret1);
+		}
+
+		/// <summary>
+		/// Mixes two 64-bit values (used for combining / seeding hash values)
+		/// </summary>
+		static uint64_t mix(uint64_t a, uint64_t b)
+		{
+			multiply(a, b);
+			return a ^ b;
+		}
+
+	private:
+
+		static constexpr uint64_t Secret0 = 0x2d358dccaa6c78a5ull;
+		static constexpr uint64_t Secret1 = 0x8bb84b93962eacc9ull;
+		static constexpr uint64_t Secret2 = 0x4b33a62ed433d4a3ull;
+		static constexpr uint64_t Secret3 = 0x4d5a2da51de1aa47ull;
+
+		/// <summary>
+		/// 128-bit product of a and b:  a = low 64 bits, b = high 64 bits
+		/// </summary>
+		static void multiply(uint64_t& a, uint64_t& b)
+		{
+#if defined(__SIZEOF_INT128__)
+			__uint128_t result = a;
+			result *= b;
+			a = (uint64_t)result;
+			b = (uint64_t)(result >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			a = _umul128(a, b, &b);
+#else
+			uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+			uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+			uint64_t t = rl + (rm0 << 32);
+			uint64_t c = t < rl;
+			uint64_t lo = t + (rm1 << 32);
+			c += lo < t;
+			uint64_t hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+			a = lo;
+			b = hi;
+#endif
+		}
+
+		static uint64_t read8(const uint8_t* bytes)
+		{
+			uint64_t value;
+			std::memcpy(&value, bytes, 8);
+			return value;
+		}
+
+		static uint64_t read4(const uint8_t* bytes)
+		{
+			uint32_t value;
+			std::memcpy(&value, bytes, 4);
+			return value;
+		}
+
+		static uint64_t read3(const uint8_t* bytes, size_t length)
+		{
+			return (((uint64_t)bytes[0]) << 16) | (((uint64_t)bytes[length >> 1]) << 8) | bytes[length - 1];
+		}
+	};
+}
@@ -22,7 +22,11 @@ namespace simple::math
 	concept isGraphNode = std::convertible_to<TNode, simpleGraphNode>;
 
 	template <typename TEdge, typename TNode>
-	concept isGraphEdge = isGraphNode<TNode> && std::convertible_to<TEdge, simpleGraphEdge<TNode>>;
+	concept isGraphEdge = isGraphNode<TNode> && std::convertible_to<TEdge, simpleGraphEdge<TNode>> &&
+		requires(const TEdge& edge)
+		{
+			{ edge.weight() } -> std::convertible_to<float>;
+		};
 
 	// Graph Delegates
 	template <isGraphNode TNode1, isGraphNode TNode2>
@@ -4,8 +4,12 @@
 
 namespace simple::math
 {
+	/// <summary>
+	/// Base value type for graph edges. There are no virtual functions here:  the edge type (e.g.
+	/// simpleLine) must provide its own weight() - which is checked by the isGraphEdge concept.
+	/// </summary>
 	template <isHashable TNode>
-	struct simpleGraphEdge : simpleStruct
+	struct simpleGraphEdge
 	{
 	public:
 		TNode node1;
@@ -23,35 +27,17 @@ namespace simple::math
 			node2 = anode2;
 		}
 
-		simpleGraphEdge(const simpleGraphEdge& copy)
-		{
-			node1 = copy.node1;
-			node2 = copy.node2;
-		}
-		virtual ~simpleGraphEdge() {}
-
-		virtual float weight() const
-		{
-			throw simpleException ("Function must be overridde in a child class:  simpelGraphEdge::weight");
-		}
-
-		virtual void operator=(const simpleGraphEdge& copy)
-		{
-			node1 = copy.node1;
-			node2 = copy.node2;
-		}
-
-		virtual bool operator==(const simpleGraphEdge& edge) const
+		bool operator==(const simpleGraphEdge& edge) const
 		{
 			return compare(edge);
 		}
 
-		virtual bool operator!=(const simpleGraphEdge& edge) const
+		bool operator!=(const simpleGraphEdge& edge) const
 		{
 			return !compare(edge);
 		}
 
-		virtual size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(node1, node2);
 		}
@@ -4,15 +4,11 @@
 
 namespace simple::math
 {
-	struct simpleGraphNode : public simpleStruct
+	/// <summary>
+	/// Empty (non-virtual) tag for graph node types. Nodes are value types (e.g. simplePoint) - so
+	/// there is no vtable here; the node type provides its own non-virtual getHash().
+	/// </summary>
+	struct simpleGraphNode
 	{
-	public:
-		simpleGraphNode()
-		{
-		};
-
-		virtual ~simpleGraphNode()
-		{
-		};
 	};
 }
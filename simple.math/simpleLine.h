@@ -6,6 +6,7 @@
 #include "simpleVectorMath.h"
 #include "simplePoint.h"
 #include "simpleVector.h"
+#include <type_traits>
 
 namespace simple::math
 {
@@ -32,18 +33,6 @@ namespace simple::math
 			this->node2 = point2;
 		}
 
-		simpleLine(const simpleLine<T>& copy)
-		{
-			this->node1 = copy.node1;
-			this->node2 = copy.node2;
-		}
-
-		void operator=(const simpleLine<T>& other)
-		{
-			this->node1 = other.node1;
-			this->node2 = other.node2;
-		}
-
 		bool operator==(const simpleLine<T>& other)
 		{
 			return this->node1 == other.node1 &&
@@ -62,7 +51,7 @@ namespace simple::math
 			this->node2.translate(offset.x, offset.y);
 		}
 
-		float weight() const override
+		float weight() const
 		{
 			return this->node1.distance (this->node2);
 		}
@@ -145,4 +134,6 @@ namespace simple::math
 					this->node2.y == point1.y);
 		}
 	};
+
+	static_assert(std::is_trivially_copyable_v<simpleLine<float>>, "simpleLine must remain trivially copyable");
 }
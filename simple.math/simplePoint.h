@@ -2,6 +2,7 @@
 
 #include "simpleGraphNode.h"
 #include <simple.h>
+#include <type_traits>
 
 namespace simple::math
 {
@@ -19,24 +20,12 @@ namespace simple::math
 			y = default_value::value<T>();
 		}
 
-		simplePoint(const simplePoint<T>& copy)
-		{
-			x = copy.x;
-			y = copy.y;
-		}
-
 		simplePoint(const T& ax, const T& ay)
 		{
 			x = ax;
 			y = ay;
 		}
 
-		void operator=(const simplePoint<T>& copy)
-		{
-			x = copy.x;
-			y = copy.y;
-		}
-
 		bool operator !=(const simplePoint<T>& point) const
 		{
 			return x != point.x || y != point.y;
@@ -61,9 +50,13 @@ namespace simple::math
 			y = y + offsetY;
 		}
 
-		size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(x, y);
 		}
 	};
+
+	// Points are packed into large arrays (graphs, polygons, triangulations)
+	static_assert(std::is_trivially_copyable_v<simplePoint<float>>, "simplePoint must remain trivially copyable");
+	static_assert(sizeof(simplePoint<float>) == 2 * sizeof(float), "simplePoint must not carry a vtable pointer");
 }
@@ -2,11 +2,12 @@
 
 #include <simple.h>
 #include <simpleMath.h>
+#include <type_traits>
 
 namespace simple::math
 {
 	template <isNumber T>
-	struct simpleVector : simpleStruct
+	struct simpleVector
 	{
 		T x;
 		T y;
@@ -23,18 +24,6 @@ namespace simple::math
 			y = ay;
 		}
 
-		simpleVector(const simpleVector<T>& copy)
-		{
-			x = copy.x;
-			y = copy.y;
-		}
-
-		void operator=(const simpleVector<T>& copy)
-		{
-			x = copy.x;
-			y = copy.y;
-		}
-
 		bool operator==(const simpleVector<T>& other)
 		{
 			return x == other.x &&
@@ -93,9 +82,11 @@ namespace simple::math
 			return (x * vector.y) - (vector.x * y);
 		}
 
-		size_t getHash() const override
+		size_t getHash() const
 		{
 			return hashGenerator::generateHash(x, y);
 		}
 	};
+
+	static_assert(std::is_trivially_copyable_v<simpleVector<float>>, "simpleVector must remain trivially copyable");
 }
@@ -3,7 +3,12 @@
 #include <simple.h>
 #include "simpleArrayTests.h"
 #include "simpleBSTTests.h"
+#include "simpleBTreeTests.h"
+#include "simpleConcurrentQueueTests.h"
 #include "simpleHashTests.h"
+#include "simpleQueueTests.h"
+#include "simpleStackTests.h"
+#include "simpleStringTests.h"
 #include "simpleRect.h"
 #include "simpleLogger.h"
 
@@ -14,12 +19,22 @@ int main()
 	std::cout << "Simple (Native) Lib:  Unit Test Project";
 
 	simpleBSTTests bstTests;
+	simpleBTreeTests bTreeTests;
+	simpleConcurrentQueueTests concurrentQueueTests;
 	simpleArrayTests arrayTests;
 	simpleHashTests hashTests;
+	simpleQueueTests queueTests;
+	simpleStackTests stackTests;
+	simpleStringTests stringTests;
 
 	bstTests.run();
+	bTreeTests.run();
+	concurrentQueueTests.run();
 	arrayTests.run();
 	hashTests.run();
+	queueTests.run();
+	stackTests.run();
+	stringTests.run();
 
 	return 0;
 }
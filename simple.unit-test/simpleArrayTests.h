@@ -4,6 +4,7 @@
 #include "simpleTestPackage.h"
 #include <simple.h>
 #include <simpleArray.h>
+#include <simpleSort.h>
 #include <simpleString.h>
 #include <functional>
 
@@ -28,6 +29,12 @@ namespace simple::test
 			                                 std::bind(&simpleArrayTests::intArray_OnStack_forEach, this)));
 			this->addTest(simpleTestFunction("intArray_OnHeap_forEach",
 			                                 std::bind(&simpleArrayTests::intArray_OnHeap_forEach, this)));
+			this->addTest(simpleTestFunction("intArray_OnStack_Sort",
+			                                 std::bind(&simpleArrayTests::intArray_OnStack_Sort, this)));
+			this->addTest(simpleTestFunction("longArray_OnStack_ParallelSort_Stable",
+			                                 std::bind(&simpleArrayTests::longArray_OnStack_ParallelSort_Stable, this)));
+			this->addTest(simpleTestFunction("intArray_OnStack_Parallel",
+			                                 std::bind(&simpleArrayTests::intArray_OnStack_Parallel, this)));
 
 			// simpleArray<simpleString>
 			this->addTest(simpleTestFunction("instantiate_StringArray_OnStack",
@@ -122,6 +129,160 @@ namespace simple::test
 			return true;
 		}
 
+		bool intArray_OnStack_Sort()
+		{
+			simpleArray<int> theArray(1000);
+
+			simpleArrayComparer<int> comparer = [](const int& item1, const int& item2)
+			{
+				return (item1 < item2) ? -1 : (item1 > item2) ? 1 : 0;
+			};
+
+			// Descending (with duplicates / negatives)
+			auto reset = [&theArray]()
+			{
+				for (int index = 0; index < theArray.count(); index++)
+					theArray.set(index, ((theArray.count() - index) % 250) - 125);
+			};
+
+			auto isSorted = [&theArray]()
+			{
+				for (int index = 1; index < theArray.count(); index++)
+				{
+					if (theArray.get(index - 1) > theArray.get(index))
+						return false;
+				}
+
+				return true;
+			};
+
+			// Sorted copy:  The array is not changed
+			reset();
+			simpleArray<int> theCopy = theArray.sort(comparer);
+
+			this->testAssert("intArray_OnStack_Sort (sort copy)", [&theArray, &theCopy]()
+			{
+				for (int index = 1; index < theCopy.count(); index++)
+				{
+					if (theCopy.get(index - 1) > theCopy.get(index))
+						return false;
+				}
+
+				return theCopy.count() == theArray.count() && theArray.get(1) == 124 && theCopy.get(0) == -125;
+			});
+
+			reset();
+			theArray.sortInPlace(comparer);
+
+			this->testAssert("intArray_OnStack_Sort (introSort)", isSorted);
+
+			reset();
+			theArray.stableSort(comparer);
+
+			this->testAssert("intArray_OnStack_Sort (stableSort)", isSorted);
+
+			reset();
+			theArray.radixSort<int>([](const int& item) { return item; });
+
+			this->testAssert("intArray_OnStack_Sort (radixSort)", isSorted);
+
+			reset();
+			theArray.parallelSort(comparer);
+
+			this->testAssert("intArray_OnStack_Sort (parallelSort)", isSorted);
+
+			return true;
+		}
+
+		bool longArray_OnStack_ParallelSort_Stable()
+		{
+			// Above simpleSort::ParallelThreshold:  Chunk sorts; merge levels; and the move back
+			const int count = simpleSort::ParallelThreshold * 3 + 17;
+			const long long keyScale = 1000000;
+
+			simpleArray<long long> theArray(count);
+
+			// Item = key * keyScale + index (many duplicate keys; the index shows the original order)
+			for (int index = 0; index < count; index++)
+				theArray.set(index, ((index * 7919LL) % 1000) * keyScale + index);
+
+			// Compares the keys only
+			simpleArrayComparer<long long> comparer = [keyScale](const long long& item1, const long long& item2)
+			{
+				long long key1 = item1 / keyScale;
+				long long key2 = item2 / keyScale;
+
+				return (key1 < key2) ? -1 : (key1 > key2) ? 1 : 0;
+			};
+
+			simpleArray<long long> theExpected(theArray);
+
+			theArray.parallelSort(comparer);
+			theExpected.stableSort(comparer);
+
+			this->testAssert("longArray_OnStack_ParallelSort_Stable", [&theArray, &theExpected, count]()
+			{
+				// Sorted and stable:  The items (key, then index) are increasing
+				for (int index = 1; index < count; index++)
+				{
+					if (theArray.get(index - 1) >= theArray.get(index))
+						return false;
+				}
+
+				for (int index = 0; index < count; index++)
+				{
+					if (theArray.get(index) != theExpected.get(index))
+						return false;
+				}
+
+				return theArray.count() == count;
+			});
+
+			return true;
+		}
+
+		bool intArray_OnStack_Parallel()
+		{
+			simpleArray<int> theArray(100000);
+
+			for (int index = 0; index < theArray.count(); index++)
+				theArray.set(index, index % 1000);
+
+			long long sum = theArray.parallelAggregate<long long>(0, [](const long long& aggregate, const int& item)
+			{
+				return aggregate + item;
+			},
+			[](const long long& aggregate1, const long long& aggregate2)
+			{
+				return aggregate1 + aggregate2;
+			});
+
+			// (bool results:  one per chunk; written concurrently)
+			bool anyLarge = theArray.parallelAggregate<bool>(false, [](const bool& aggregate, const int& item)
+			{
+				return aggregate || item == 999;
+			},
+			[](const bool& aggregate1, const bool& aggregate2)
+			{
+				return aggregate1 || aggregate2;
+			});
+
+			simpleArray<int> doubled = theArray.parallelSelect<int>([](const int& item) { return item * 2; });
+			simpleArray<int> zeros = theArray.parallelWhere([](const int& item) { return item == 0; });
+
+			this->testAssert("intArray_OnStack_Parallel", [&sum, &anyLarge, &doubled, &zeros]()
+			{
+				return sum == 100LL * (999 * 1000 / 2) &&
+					   anyLarge &&
+					   doubled.count() == 100000 &&
+					   doubled.get(99999) == 1998 &&
+					   zeros.count() == 100 &&
+					   zeros.get(99) == 0;
+			});
+
+			return true;
+		}
+
 		bool instantiate_StringArray_OnStack()
 		{
 			simpleArray<simpleString> theArray(10);
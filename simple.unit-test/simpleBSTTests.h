@@ -17,6 +17,15 @@ namespace simple::test
 			// simpelBST<int, int>
 			this->addTest(simpleTestFunction("simpleBSTTests_createAndBalance",
 			                                 std::bind(&simpleBSTTests::createAndBalance, this)));
+
+			this->addTest(simpleTestFunction("simpleBSTTests_orderedRangeBounds",
+			                                 std::bind(&simpleBSTTests::orderedRangeBounds, this)));
+
+			this->addTest(simpleTestFunction("simpleBSTTests_orderStatistics",
+			                                 std::bind(&simpleBSTTests::orderStatistics, this)));
+
+			this->addTest(simpleTestFunction("simpleBSTTests_fromSorted",
+			                                 std::bind(&simpleBSTTests::fromSorted, this)));
 		}
 
 		~simpleBSTTests()
@@ -58,5 +67,104 @@ namespace simple::test
 
 			return true;
 		}
+
+		bool orderedRangeBounds()
+		{
+			simpleBST<int, int> tree;
+
+			// Inserted out of order
+			for (int index = 0; index < 100; index++)
+				tree.insert((index * 37) % 100 * 10, index);
+
+			int lastKey = -1;
+			bool ordered = true;
+
+			tree.iterate([&lastKey, &ordered] (int key, int value)
+			{
+				ordered &= key > lastKey;
+				lastKey = key;
+
+				return iterationCallback::iterate;
+			});
+
+			int rangeCount = 0;
+
+			tree.rangeIterate(95, 205, [&rangeCount] (int key, int value)
+			{
+				rangeCount++;
+				return iterationCallback::iterate;
+			});
+
+			this->testAssert("simpleBSTTests_orderedRangeBounds", [&tree, &ordered, &rangeCount]()
+			{
+				return ordered &&
+					   rangeCount == 11 &&
+					   tree.lowerBound(100)->getKey() == 100 &&
+					   tree.lowerBound(101)->getKey() == 110 &&
+					   tree.upperBound(100)->getKey() == 110 &&
+					   tree.predecessor(100)->getKey() == 90 &&
+					   tree.successor(990) == nullptr &&
+					   tree.predecessor(0) == nullptr;
+			});
+
+			return true;
+		}
+
+		bool orderStatistics()
+		{
+			simpleBST<int, int> tree;
+
+			for (int index = 0; index < 100; index++)
+				tree.insert((index * 37) % 100, index);
+
+			// Remove the odd keys (rebalances the tree)
+			for (int index = 1; index < 100; index += 2)
+				tree.remove(index);
+
+			this->testAssert("simpleBSTTests_orderStatistics", [&tree]()
+			{
+				return tree.count() == 50 &&
+					   tree.rank(0) == 0 &&
+					   tree.rank(50) == 25 &&
+					   tree.rank(51) == 26 &&
+					   tree.select(0)->getKey() == 0 &&
+					   tree.select(10)->getKey() == 20 &&
+					   tree.select(49)->getKey() == 98 &&
+					   tree.countInRange(10, 20) == 6 &&
+					   tree.countInRange(11, 11) == 0;
+			});
+
+			return true;
+		}
+
+		bool fromSorted()
+		{
+			simpleBST<int, int> tree;
+			simpleArray<int> keys(1000);
+			simpleArray<int> values(1000);
+
+			for (int index = 0; index < keys.count(); index++)
+			{
+				keys.set(index, index * 2);
+				values.set(index, index);
+			}
+
+			tree.fromSorted(keys, values);
+
+			// Tree is still a valid AVL tree after the bulk build
+			tree.insert(1, -1);
+			tree.remove(0);
+
+			this->testAssert("simpleBSTTests_fromSorted", [&tree]()
+			{
+				return tree.count() == 1000 &&
+					   tree.minKey() == 1 &&
+					   tree.maxKey() == 1998 &&
+					   tree.get(500) == 250 &&
+					   tree.select(1)->getKey() == 2;
+			});
+
+			return true;
+		}
 	};
 }
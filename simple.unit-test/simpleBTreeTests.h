@@ -0,0 +1,99 @@
+#pragma once
+
+#include "simpleTestFunction.h"
+#include "simpleTestPackage.h"
+#include <simpleBTree.h>
+#include <functional>
+
+namespace simple::test
+{
+	class simpleBTreeTests : public simpleTestPackage
+	{
+	public:
+		simpleBTreeTests() : simpleTestPackage("Simple B+ Tree Tests")
+		{
+			// simpleBTree<int, int>
+			this->addTest(simpleTestFunction("simpleBTreeTests_insertRemoveOrder",
+			                                 std::bind(&simpleBTreeTests::insertRemoveOrder, this)));
+
+			this->addTest(simpleTestFunction("simpleBTreeTests_rangeSuccessorPredecessor",
+			                                 std::bind(&simpleBTreeTests::rangeSuccessorPredecessor, this)));
+		}
+
+		~simpleBTreeTests()
+		{
+		}
+
+		bool insertRemoveOrder()
+		{
+			simpleBTree<int, int> tree;
+
+			// Enough keys for several levels (forces splits / merges)
+			const int count = simpleBTree<int, int>::NodeCapacity * 50;
+
+			for (int index = 0; index < count; index++)
+				tree.insert((index * 7919) % count, index);
+
+			for (int index = 0; index < count; index += 2)
+				tree.remove(index);
+
+			bool ordered = true;
+			int lastKey = -1;
+
+			tree.iterate([&ordered, &lastKey] (const int& key, const int& value)
+			{
+				ordered &= (key > lastKey) && (key % 2 == 1);
+				lastKey = key;
+
+				return iterationCallback::iterate;
+			});
+
+			this->testAssert("simpleBTreeTests_insertRemoveOrder", [&tree, &ordered, &count]()
+			{
+				return ordered &&
+					   tree.count() == count / 2 &&
+					   tree.minKey() == 1 &&
+					   tree.maxKey() == count - 1 &&
+					   !tree.containsKey(2) &&
+					   tree.containsKey(3);
+			});
+
+			return true;
+		}
+
+		bool rangeSuccessorPredecessor()
+		{
+			simpleBTree<int, int> tree;
+
+			for (int index = 0; index < 1000; index++)
+				tree.insert(index * 10, index);
+
+			int rangeCount = 0;
+			int rangeSum = 0;
+
+			tree.rangeIterate(95, 205, [&rangeCount, &rangeSum] (const int& key, const int& value)
+			{
+				rangeCount++;
+				rangeSum += value;
+
+				return iterationCallback::iterate;
+			});
+
+			int result = 0;
+
+			this->testAssert("simpleBTreeTests_rangeSuccessorPredecessor", [&tree, &rangeCount, &rangeSum, &result]()
+			{
+				// Keys 100 -> 200
+				return rangeCount == 11 &&
+					   rangeSum == 165 &&
+					   tree.successor(100) == 110 &&
+					   tree.successor(105) == 110 &&
+					   tree.predecessor(100) == 90 &&
+					   !tree.tryPredecessor(0, result) &&
+					   !tree.trySuccessor(9990, result);
+			});
+
+			return true;
+		}
+	};
+}
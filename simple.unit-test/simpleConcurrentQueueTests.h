@@ -0,0 +1,215 @@
+#pragma once
+
+#include "simpleTestFunction.h"
+#include "simpleTestPackage.h"
+#include <simpleMPMCQueue.h>
+#include <simpleSPSCQueue.h>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+
+namespace simple::test
+{
+	class simpleConcurrentQueueTests : public simpleTestPackage
+	{
+	public:
+		simpleConcurrentQueueTests() : simpleTestPackage("Simple Concurrent Queue Tests")
+		{
+			// simpleSPSCQueue<int>
+			this->addTest(simpleTestFunction("simpleConcurrentQueueTests_spscFifoWrapAround",
+			                                 std::bind(&simpleConcurrentQueueTests::spscFifoWrapAround, this)));
+
+			this->addTest(simpleTestFunction("simpleConcurrentQueueTests_spscFullEmptyBatch",
+			                                 std::bind(&simpleConcurrentQueueTests::spscFullEmptyBatch, this)));
+
+			// simpleMPMCQueue<int>
+			this->addTest(simpleTestFunction("simpleConcurrentQueueTests_mpmcFifoWrapAround",
+			                                 std::bind(&simpleConcurrentQueueTests::mpmcFifoWrapAround, this)));
+
+			this->addTest(simpleTestFunction("simpleConcurrentQueueTests_mpmcFullEmptyBatch",
+			                                 std::bind(&simpleConcurrentQueueTests::mpmcFullEmptyBatch, this)));
+
+			this->addTest(simpleTestFunction("simpleConcurrentQueueTests_mpmcThreadedSum",
+			                                 std::bind(&simpleConcurrentQueueTests::mpmcThreadedSum, this)));
+		}
+
+		~simpleConcurrentQueueTests()
+		{
+		}
+
+		bool spscFifoWrapAround()
+		{
+			simpleSPSCQueue<int> queue(8);
+
+			bool ordered = this->fifoWrapAround(queue);
+
+			this->testAssert("simpleConcurrentQueueTests_spscFifoWrapAround", [&]()
+			{
+				return ordered && queue.count() == 0;
+			});
+
+			return true;
+		}
+
+		bool spscFullEmptyBatch()
+		{
+			simpleSPSCQueue<int> queue(4);
+
+			bool result = this->fullEmptyBatch(queue);
+
+			this->testAssert("simpleConcurrentQueueTests_spscFullEmptyBatch", [&]()
+			{
+				return result;
+			});
+
+			return true;
+		}
+
+		bool mpmcFifoWrapAround()
+		{
+			simpleMPMCQueue<int> queue(8);
+
+			bool ordered = this->fifoWrapAround(queue);
+
+			this->testAssert("simpleConcurrentQueueTests_mpmcFifoWrapAround", [&]()
+			{
+				return ordered && queue.count() == 0;
+			});
+
+			return true;
+		}
+
+		bool mpmcFullEmptyBatch()
+		{
+			simpleMPMCQueue<int> queue(4);
+
+			bool result = this->fullEmptyBatch(queue);
+
+			this->testAssert("simpleConcurrentQueueTests_mpmcFullEmptyBatch", [&]()
+			{
+				return result;
+			});
+
+			return true;
+		}
+
+		bool mpmcThreadedSum()
+		{
+			const int producerCount = 4;
+			const int consumerCount = 4;
+			const int itemsPerProducer = 20000;
+
+			simpleMPMCQueue<int> queue(64);
+
+			std::atomic<long long> sum = 0;
+			std::atomic<int> consumed = 0;
+			std::vector<std::thread> threads;
+
+			for (int producer = 0; producer < producerCount; producer++)
+			{
+				threads.emplace_back([&queue, producer, itemsPerProducer]()
+				{
+					for (int index = 1; index <= itemsPerProducer; index++)
+					{
+						int item = producer * itemsPerProducer + index;
+
+						while (!queue.tryEnqueue(item))
+							std::this_thread::yield();
+					}
+				});
+			}
+
+			for (int consumer = 0; consumer < consumerCount; consumer++)
+			{
+				threads.emplace_back([&queue, &sum, &consumed, producerCount, itemsPerProducer]()
+				{
+					int batch[16];
+
+					while (consumed.load() < producerCount * itemsPerProducer)
+					{
+						int count = queue.tryDequeueBatch(batch, 16);
+
+						for (int index = 0; index < count; index++)
+							sum += batch[index];
+
+						consumed += count;
+
+						if (count == 0)
+							std::this_thread::yield();
+					}
+				});
+			}
+
+			for (int index = 0; index < (int)threads.size(); index++)
+				threads[index].join();
+
+			long long total = (long long)producerCount * itemsPerProducer;
+			long long expected = total * (total + 1) / 2;
+
+			this->testAssert("simpleConcurrentQueueTests_mpmcThreadedSum", [&]()
+			{
+				return consumed.load() == total && sum.load() == expected && queue.count() == 0;
+			});
+
+			return true;
+		}
+
+	private:
+
+		/// <summary>
+		/// Interleaved enqueue / dequeue (single thread) so the positions wrap around many times
+		/// </summary>
+		template<typename TQueue>
+		bool fifoWrapAround(TQueue& queue)
+		{
+			int next = 0;
+			int expected = 0;
+			int item = 0;
+			bool ordered = true;
+
+			for (int round = 0; round < 100; round++)
+			{
+				for (int index = 0; index < 1 + round % 5; index++)
+					ordered &= queue.tryEnqueue(next++);
+
+				while (queue.tryDequeue(item))
+					ordered &= item == expected++;
+			}
+
+			return ordered && next == expected;
+		}
+
+		/// <summary>
+		/// Full / empty results; partial batch claims; and zero-count batches (capacity 4)
+		/// </summary>
+		template<typename TQueue>
+		bool fullEmptyBatch(TQueue& queue)
+		{
+			int items[] = { 1, 2, 3, 4, 5, 6 };
+			int destination[6] = { 0 };
+			int item = 0;
+
+			bool emptyDequeue = !queue.tryDequeue(item);
+			bool zeroEnqueue = queue.tryEnqueueBatch(items, 0) == 0;
+			bool zeroDequeueEmpty = queue.tryDequeueBatch(destination, 0) == 0;
+
+			// Partial:  Only 4 fit
+			int enqueued = queue.tryEnqueueBatch(items, 6);
+			bool fullEnqueue = !queue.tryEnqueue(7);
+			bool zeroEnqueueFull = queue.tryEnqueueBatch(items, 0) == 0;
+
+			// Zero count with a ready head cell
+			bool zeroDequeueReady = queue.tryDequeueBatch(destination, 0) == 0;
+
+			int firstBatch = queue.tryDequeueBatch(destination, 3);
+			int secondBatch = queue.tryDequeueBatch(destination + 3, 3);
+
+			return emptyDequeue && zeroEnqueue && zeroDequeueEmpty &&
+				   enqueued == 4 && fullEnqueue && zeroEnqueueFull && zeroDequeueReady &&
+				   firstBatch == 3 && secondBatch == 1 &&
+				   destination[0] == 1 && destination[3] == 4 &&
+				   queue.count() == 0 && !queue.tryDequeue(item);
+		}
+	};
+}
@@ -3,13 +3,27 @@
 #include "simpleTestFunction.h"
 #include "simpleTestPackage.h"
 #include <simple.h>
+#include <simpleArray.h>
+#include <simpleConcurrentHash.h>
 #include <simpleHash.h>
+#include <simpleHashStdCore.h>
 #include <simpleString.h>
+#include <simpleStringView.h>
+#include <simpleWyHash.h>
+#include <simplePoint.h>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
 #include <functional>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 namespace simple::test
 {
 	using namespace simple;
+	using namespace simple::math;
 
 	class simpleHashTests : public simpleTestPackage
 	{
@@ -44,6 +58,40 @@ namespace simple::test
 			                                 std::bind(&simpleHashTests::stringString_OnStack_iterate, this)));
 			this->addTest(simpleTestFunction("stringString_OnHeap_iterate",
 			                                 std::bind(&simpleHashTests::stringString_OnHeap_iterate, this)));
+
+			// simpleHash<simplePoint<float>, int> (value type key - no vtable)
+			this->addTest(simpleTestFunction("pointInt_OnStack_Add_Get",
+			                                 std::bind(&simpleHashTests::pointInt_OnStack_Add_Get, this)));
+
+			// simpleHashStdCore<simpleString, int>
+			this->addTest(simpleTestFunction("stdCore_StringInt_Lookup_Remove_Order",
+			                                 std::bind(&simpleHashTests::stdCore_StringInt_Lookup_Remove_Order, this)));
+
+			// simpleHash<simpleString, int> (std::string is converted to the key; not hashed as a lookup)
+			this->addTest(simpleTestFunction("stringInt_OnStack_StdString_Lookup",
+			                                 std::bind(&simpleHashTests::stringInt_OnStack_StdString_Lookup, this)));
+
+			// hashGenerator / simpleWyHash
+			this->addTest(simpleTestFunction("wyHash_KnownValues",
+			                                 std::bind(&simpleHashTests::wyHash_KnownValues, this)));
+			this->addTest(simpleTestFunction("bytesHash_String_CharArray",
+			                                 std::bind(&simpleHashTests::bytesHash_String_CharArray, this)));
+			this->addTest(simpleTestFunction("seededHash_Seeds_Differ",
+			                                 std::bind(&simpleHashTests::seededHash_Seeds_Differ, this)));
+
+			// simpleHash<int, int, simpleHashDynamicCore<int, int>>
+			this->addTest(simpleTestFunction("dynamicCore_IntInt_Copy",
+			                                 std::bind(&simpleHashTests::dynamicCore_IntInt_Copy, this)));
+
+			// simpleHashBasicCore:  inline (small) entries -> bucket table
+			this->addTest(simpleTestFunction("intInt_OnStack_Small_Overflow_Order",
+			                                 std::bind(&simpleHashTests::intInt_OnStack_Small_Overflow_Order, this)));
+
+			// simpleConcurrentHash<int, int>
+			this->addTest(simpleTestFunction("concurrentHash_IntInt_GetOrAdd_Compute",
+			                                 std::bind(&simpleHashTests::concurrentHash_IntInt_GetOrAdd_Compute, this)));
+			this->addTest(simpleTestFunction("concurrentHash_IntInt_Threaded",
+			                                 std::bind(&simpleHashTests::concurrentHash_IntInt_Threaded, this)));
 		}
 
 		~simpleHashTests()
@@ -198,5 +246,307 @@ namespace simple::test
 
 			return true;
 		}
+
+		bool pointInt_OnStack_Add_Get()
+		{
+			simpleHash<simplePoint<float>, int> theHash;
+
+			for (int index = 0; index < 200; index++)
+				theHash.add(simplePoint<float>(index, -index), index);
+
+			this->testAssert("pointInt_OnStack_Add_Get", [&theHash]()
+			{
+				return theHash.count() == 200 &&
+					   theHash.get(simplePoint<float>(57, -57)) == 57 &&
+					   !theHash.contains(simplePoint<float>(57, 57));
+			});
+
+			return std::is_trivially_copyable_v<simplePoint<float>>;
+		}
+
+		bool stdCore_StringInt_Lookup_Remove_Order()
+		{
+			simpleHashStdCore<simpleString, int> theCore;
+
+			theCore.add("first", 1);
+			theCore.add("second", 2);
+			theCore.add("third", 3);
+			theCore.add("fourth", 4);
+
+			theCore.remove("second");
+
+			this->testAssert("stdCore_StringInt_Lookup_Remove_Order", [&theCore]()
+			{
+				// (const char* lookup without constructing a simpleString)
+				return theCore.count() == 3 &&
+					   theCore.get("third") == 3 &&
+					   !theCore.contains("second") &&
+					   theCore.getAt(0)->getValue() == 1 &&
+					   theCore.getAt(1)->getValue() == 3 &&
+					   theCore.getAt(2)->getValue() == 4;
+			});
+
+			return true;
+		}
+
+		bool stringInt_OnStack_StdString_Lookup()
+		{
+			simpleHash<simpleString, int> theHash;
+
+			theHash.add("abc", 1);
+			theHash.add(std::string("def"), 2);
+
+			this->testAssert("stringInt_OnStack_StdString_Lookup", [&theHash]()
+			{
+				return theHash.contains(std::string("abc")) &&
+					   theHash.get(std::string("def")) == 2 &&
+					   theHash.contains(simpleStringView("def", 3)) &&
+					   theHash.contains("abc") &&
+					   !theHash.contains(std::string("abd"));
+			});
+
+			return true;
+		}
+
+		bool wyHash_KnownValues()
+		{
+			// wyhash (final version 4) test vectors:  input i is hashed with seed i
+			const char* inputs[] = { "",
+									 "a",
+									 "abc",
+									 "message digest",
+									 "abcdefghijklmnopqrstuvwxyz",
+									 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+									 "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+
+			const uint64_t expected[] = { 0x93228a4de0eec5a2ull,
+										  0xc5bac3db178713c4ull,
+										  0xa97f2f7b1d9b3314ull,
+										  0x786d1f1df3801df4ull,
+										  0xdca5a8138ad37c87ull,
+										  0xb9e734f117cfaf70ull,
+										  0x6cc5eab49a92d617ull };
+
+			bool matched = true;
+
+			for (int index = 0; index < 7; index++)
+				matched &= simpleWyHash::hash(inputs[index], std::strlen(inputs[index]), (uint64_t)index) == expected[index];
+
+			this->testAssert("wyHash_KnownValues", [&matched]()
+			{
+				// (The unseeded hash is seed 0)
+				return matched && simpleWyHash::hash("", 0) == 0x93228a4de0eec5a2ull;
+			});
+
+			return true;
+		}
+
+		bool bytesHash_String_CharArray()
+		{
+			const char* text = "the quick brown fox jumps over the lazy dog (49+ bytes; bulk path)";
+
+			simpleString theString(text);
+			simpleArray<char> theArray((int)std::strlen(text));
+
+			for (int index = 0; index < theArray.count(); index++)
+				theArray.set(index, text[index]);
+
+			this->testAssert("bytesHash_String_CharArray", [&theString, &theArray, &text]()
+			{
+				return theString.getHash() == theArray.getHash() &&
+					   theString.getHash() == hashGenerator::generateBytesHash(text, std::strlen(text)) &&
+					   theString.getHash() == simpleStringView(text, (int)std::strlen(text)).getHash();
+			});
+
+			return true;
+		}
+
+		bool seededHash_Seeds_Differ()
+		{
+			simpleString theString("seeded");
+
+			size_t seed1 = theString.getHash(1);
+			size_t seed2 = theString.getHash(2);
+
+			simpleHashStdCore<simpleString, int> theCore;
+
+			theCore.add("seeded", 1);
+
+			this->testAssert("seededHash_Seeds_Differ", [&]()
+			{
+				return seed1 != seed2 &&
+					   seed1 == theString.getHash(1) &&
+					   seed1 == simpleStringView("seeded", 6).getHash(1) &&
+					   hashGenerator::generateSeededHash(1, 42) != hashGenerator::generateSeededHash(2, 42) &&
+					   simpleHashStdKey::seededHash(theString) == simpleHashStdKey::seededHash("seeded") &&
+					   theCore.contains("seeded") &&
+					   theCore.contains(simpleStringView("seeded", 6));
+			});
+
+			return true;
+		}
+
+		bool dynamicCore_IntInt_Copy()
+		{
+			simpleHash<int, int, simpleHashDynamicCore<int, int>> theHash(simpleHashBackend::Std);
+
+			for (int index = 0; index < 100; index++)
+				theHash.add(index, index * 2);
+
+			simpleHash<int, int, simpleHashDynamicCore<int, int>> theCopy(theHash);
+
+			theCopy.remove(10);
+
+			this->testAssert("dynamicCore_IntInt_Copy", [&theHash, &theCopy]()
+			{
+				return theHash.count() == 100 &&
+					   theCopy.count() == 99 &&
+					   theHash.contains(10) &&
+					   theCopy.get(11) == 22;
+			});
+
+			return true;
+		}
+
+		bool intInt_OnStack_Small_Overflow_Order()
+		{
+			simpleHash<int, int> theHash;
+
+			const int count = simpleHashBasicCore<int, int>::SmallCapacity * 3;
+
+			for (int index = 0; index < count; index++)
+			{
+				theHash.add(index, index);
+
+				// Remove one while still in small mode
+				if (index == 2)
+					theHash.remove(1);
+			}
+
+			this->testAssert("intInt_OnStack_Small_Overflow_Order", [&theHash, &count]()
+			{
+				return theHash.count() == count - 1 &&
+					   !theHash.contains(1) &&
+					   theHash.getAt(0)->getKey() == 0 &&
+					   theHash.getAt(1)->getKey() == 2 &&
+					   theHash.get(count - 1) == count - 1;
+			});
+
+			return true;
+		}
+
+		bool concurrentHash_IntInt_GetOrAdd_Compute()
+		{
+			simpleConcurrentHash<int, int> theHash;
+
+			int factoryCalls = 0;
+
+			for (int index = 0; index < 1000; index++)
+			{
+				// Counts per key (index % 10)
+				theHash.compute(index % 10, [](const int& key, const int* currentValue)
+				{
+					return (currentValue == nullptr) ? 1 : *currentValue + 1;
+				});
+
+				theHash.getOrAdd(100, [&factoryCalls](const int& key)
+				{
+					factoryCalls++;
+					return key * 2;
+				});
+			}
+
+			int snapshotCount = 0;
+
+			theHash.iterate([&snapshotCount](const int& key, const int& value)
+			{
+				snapshotCount++;
+				return iterationCallback::iterate;
+			});
+
+			this->testAssert("concurrentHash_IntInt_GetOrAdd_Compute", [&theHash, &factoryCalls, &snapshotCount]()
+			{
+				return theHash.count() == 11 &&
+					   snapshotCount == 11 &&
+					   factoryCalls == 1 &&
+					   theHash.get(100) == 200 &&
+					   theHash.get(3) == 100;
+			});
+
+			return true;
+		}
+
+		bool concurrentHash_IntInt_Threaded()
+		{
+			const int threadCount = 8;
+			const int keyCount = 256;
+			const int rounds = 50;
+
+			simpleConcurrentHash<int, int> theHash;
+
+			std::vector<std::atomic<int>> factoryCalls(keyCount);
+			std::vector<std::thread> threads;
+
+			// Every thread adds the same keys (getOrAdd); and counts them (compute)
+			for (int thread = 0; thread < threadCount; thread++)
+			{
+				threads.emplace_back([&theHash, &factoryCalls, keyCount, rounds]()
+				{
+					for (int round = 0; round < rounds; round++)
+					{
+						for (int key = 0; key < keyCount; key++)
+						{
+							theHash.getOrAdd(keyCount + key, [&factoryCalls, keyCount](const int& addedKey)
+							{
+								factoryCalls[addedKey - keyCount]++;
+								return addedKey;
+							});
+
+							theHash.compute(key, [](const int&, const int* currentValue)
+							{
+								return (currentValue == nullptr) ? 1 : *currentValue + 1;
+							});
+						}
+					}
+				});
+			}
+
+			for (int index = 0; index < (int)threads.size(); index++)
+				threads[index].join();
+
+			// Copies in both directions at once (must not deadlock)
+			simpleConcurrentHash<int, int> theOther(theHash);
+
+			std::thread copyTo([&theHash, &theOther]()
+			{
+				for (int index = 0; index < 20; index++)
+					theOther = theHash;
+			});
+
+			std::thread copyFrom([&theHash, &theOther]()
+			{
+				for (int index = 0; index < 20; index++)
+					theHash = theOther;
+			});
+
+			copyTo.join();
+			copyFrom.join();
+
+			this->testAssert("concurrentHash_IntInt_Threaded", [&]()
+			{
+				bool result = theHash.count() == keyCount * 2 && theOther.count() == keyCount * 2;
+
+				for (int key = 0; key < keyCount; key++)
+				{
+					result &= factoryCalls[key] == 1;
+					result &= theHash.get(key) == threadCount * rounds;
+					result &= theHash.get(keyCount + key) == keyCount + key;
+				}
+
+				return result;
+			});
+
+			return true;
+		}
 	};
 }
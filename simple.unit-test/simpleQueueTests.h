@@ -0,0 +1,108 @@
+#pragma once
+
+#include "simpleTestFunction.h"
+#include "simpleTestPackage.h"
+#include <simpleList.h>
+#include <simpleQueue.h>
+#include <functional>
+
+namespace simple::test
+{
+	class simpleQueueTests : public simpleTestPackage
+	{
+	public:
+		simpleQueueTests() : simpleTestPackage("Simple Queue Tests")
+		{
+			// simpleQueue<int>
+			this->addTest(simpleTestFunction("simpleQueueTests_fifoWrapAround",
+			                                 std::bind(&simpleQueueTests::fifoWrapAround, this)));
+
+			this->addTest(simpleTestFunction("simpleQueueTests_rangeBatchPeek",
+			                                 std::bind(&simpleQueueTests::rangeBatchPeek, this)));
+		}
+
+		~simpleQueueTests()
+		{
+		}
+
+		bool fifoWrapAround()
+		{
+			simpleQueue<int> queue(8);
+
+			int next = 0;
+			int expected = 0;
+			bool ordered = true;
+
+			// Interleave enqueue / dequeue so the head wraps around (and the buffer grows while wrapped)
+			for (int round = 0; round < 100; round++)
+			{
+				for (int index = 0; index < 5 + round % 7; index++)
+					queue.enqueue(next++);
+
+				for (int index = 0; index < 3; index++)
+					ordered &= queue.dequeue() == expected++;
+			}
+
+			int item = 0;
+
+			while (queue.tryDequeue(item))
+				ordered &= item == expected++;
+
+			this->testAssert("simpleQueueTests_fifoWrapAround", [&queue, &ordered, &next, &expected]()
+			{
+				return ordered && queue.count() == 0 && next == expected && !queue.tryDequeue(next);
+			});
+
+			return true;
+		}
+
+		bool rangeBatchPeek()
+		{
+			int items[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+			simpleQueue<int> queue;
+			simpleList<int> batch;
+
+			queue.enqueueRange(items, 10);
+
+			int firstBatch = queue.dequeueBatch(batch, 4);
+			int front = queue.peek();
+
+			simpleQueue<int> copy(queue);
+
+			int secondBatch = queue.dequeueBatch(batch, 100);
+
+			// Negative counts:  Nothing is dequeued; and a negative range is rejected
+			copy.enqueueRange(items, 0);
+
+			int negativeBatch = copy.dequeueBatch(batch, -3);
+			bool negativeRangeThrew = false;
+
+			try
+			{
+				copy.enqueueRange(items, -1);
+			}
+			catch (simpleException&)
+			{
+				negativeRangeThrew = true;
+			}
+
+			this->testAssert("simpleQueueTests_rangeBatchPeek", [&]()
+			{
+				return firstBatch == 4 &&
+					   secondBatch == 6 &&
+					   front == 5 &&
+					   batch.count() == 10 &&
+					   batch.get(0) == 1 &&
+					   batch.get(9) == 10 &&
+					   queue.count() == 0 &&
+					   negativeBatch == 0 &&
+					   negativeRangeThrew &&
+					   copy.count() == 6 &&
+					   copy.peek() == 5;
+			});
+
+			return true;
+		}
+	};
+}
@@ -0,0 +1,217 @@
+#pragma once
+
+#include "simpleTestFunction.h"
+#include "simpleTestPackage.h"
+#include <simpleStack.h>
+#include <simpleString.h>
+#include <functional>
+
+namespace simple::test
+{
+	class simpleStackTests : public simpleTestPackage
+	{
+	public:
+		simpleStackTests() : simpleTestPackage("Simple Stack Tests")
+		{
+			// simpleStack<int>
+			this->addTest(simpleTestFunction("simpleStackTests_pushPopOrder",
+			                                 std::bind(&simpleStackTests::pushPopOrder, this)));
+
+			this->addTest(simpleTestFunction("simpleStackTests_popInto",
+			                                 std::bind(&simpleStackTests::popInto, this)));
+
+			this->addTest(simpleTestFunction("simpleStackTests_reserve",
+			                                 std::bind(&simpleStackTests::reserve, this)));
+
+			this->addTest(simpleTestFunction("simpleStackTests_forEachOrder",
+			                                 std::bind(&simpleStackTests::forEachOrder, this)));
+
+			// simpleStack<simpleString>
+			this->addTest(simpleTestFunction("simpleStackTests_copyAssignment",
+			                                 std::bind(&simpleStackTests::copyAssignment, this)));
+
+			this->addTest(simpleTestFunction("simpleStackTests_getHash",
+			                                 std::bind(&simpleStackTests::getHash, this)));
+		}
+
+		~simpleStackTests()
+		{
+		}
+
+		bool pushPopOrder()
+		{
+			simpleStack<int> theStack;
+
+			for (int index = 0; index < 100; index++)
+				theStack.push(index);
+
+			bool ordered = theStack.peek() == 99;
+
+			for (int index = 99; index >= 0; index--)
+				ordered &= theStack.pop() == index;
+
+			bool threw = false;
+
+			try
+			{
+				theStack.pop();
+			}
+			catch (simpleException&)
+			{
+				threw = true;
+			}
+
+			this->testAssert("simpleStackTests_pushPopOrder", [&]()
+			{
+				return ordered && threw && theStack.count() == 0;
+			});
+
+			return true;
+		}
+
+		bool popInto()
+		{
+			simpleStack<int> theStack;
+
+			theStack.push(1);
+			theStack.push(2);
+
+			int first = 0;
+			int second = 0;
+			int empty = -1;
+
+			bool popped = theStack.popInto(first) && theStack.popInto(second);
+			bool poppedEmpty = theStack.popInto(empty);
+
+			this->testAssert("simpleStackTests_popInto", [&]()
+			{
+				return popped && !poppedEmpty &&
+					   first == 2 && second == 1 && empty == -1 &&
+					   theStack.count() == 0;
+			});
+
+			return true;
+		}
+
+		bool reserve()
+		{
+			simpleStack<int> theStack;
+
+			theStack.reserve(100);
+			theStack.push(0);
+
+			const int* bottom = this->getBottom(theStack);
+
+			for (int index = 1; index < 100; index++)
+				theStack.push(index);
+
+			// No reallocation:  The bottom item has not moved
+			bool reserved = this->getBottom(theStack) == bottom;
+
+			theStack.push(100);
+
+			this->testAssert("simpleStackTests_reserve", [&]()
+			{
+				return reserved && theStack.count() == 101 && theStack.peek() == 100;
+			});
+
+			return true;
+		}
+
+		bool forEachOrder()
+		{
+			simpleStack<int> theStack;
+
+			for (int index = 0; index < 10; index++)
+				theStack.push(index);
+
+			int expected = 9;
+			bool ordered = true;
+			int visited = 0;
+
+			theStack.forEach([&expected, &ordered, &visited](const int& item)
+			{
+				ordered &= item == expected--;
+				visited++;
+
+				return (visited == 5) ? iterationCallback::breakAndReturn : iterationCallback::iterate;
+			});
+
+			this->testAssert("simpleStackTests_forEachOrder", [&]()
+			{
+				return ordered && visited == 5;
+			});
+
+			return true;
+		}
+
+		bool copyAssignment()
+		{
+			simpleStack<simpleString> theStack;
+
+			theStack.push("bottom");
+			theStack.push("top");
+
+			simpleStack<simpleString> theCopy(theStack);
+			simpleStack<simpleString> theAssigned;
+
+			theAssigned.push("replaced");
+			theAssigned = theStack;
+
+			theStack.pop();
+			theStack.push("changed");
+
+			theCopy.push("copy");
+
+			this->testAssert("simpleStackTests_copyAssignment", [&]()
+			{
+				return theStack.count() == 2 && theStack.peek() == "changed" &&
+					   theCopy.count() == 3 && theCopy.peek() == "copy" &&
+					   theAssigned.count() == 2 && theAssigned.pop() == "top" && theAssigned.pop() == "bottom";
+			});
+
+			return true;
+		}
+
+		bool getHash()
+		{
+			simpleStack<simpleString> theStack;
+			simpleStack<simpleString> theOther(20);
+
+			theStack.push("a");
+			theStack.push("b");
+
+			theOther.push("a");
+			theOther.push("b");
+
+			size_t equalHash = theOther.getHash();
+
+			theOther.pop();
+			theOther.push("c");
+
+			this->testAssert("simpleStackTests_getHash", [&]()
+			{
+				return theStack.getHash() == equalHash &&
+					   theStack.getHash() != theOther.getHash();
+			});
+
+			return true;
+		}
+
+	private:
+
+		const int* getBottom(const simpleStack<int>& theStack)
+		{
+			const int* bottom = nullptr;
+
+			// (Top -> Bottom:  The last item is the bottom)
+			theStack.forEach([&bottom](const int& item)
+			{
+				bottom = &item;
+				return iterationCallback::iterate;
+			});
+
+			return bottom;
+		}
+	};
+}
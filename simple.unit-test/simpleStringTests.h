@@ -0,0 +1,491 @@
+#pragma once
+
+#include "simpleTestFunction.h"
+#include "simpleTestPackage.h"
+#include <simpleRope.h>
+#include <simpleExt.h>
+#include <simpleFileIO.h>
+#include <simpleFormat.h>
+#include <simpleHash.h>
+#include <simpleHashStdCore.h>
+#include <simpleMappedFile.h>
+#include <simpleNumber.h>
+#include <simpleString.h>
+#include <simpleStringBuilder.h>
+#include <simpleStringMatcher.h>
+#include <simpleStringPool.h>
+#include <simpleStringView.h>
+#include <simpleTextReader.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+
+namespace simple::test
+{
+	class simpleStringTests : public simpleTestPackage
+	{
+	public:
+		simpleStringTests() : simpleTestPackage("Simple String Tests")
+		{
+			// simpleString
+			this->addTest(simpleTestFunction("simpleStringTests_smallAndGrowth",
+			                                 std::bind(&simpleStringTests::smallAndGrowth, this)));
+
+			this->addTest(simpleTestFunction("simpleStringTests_insertRemoveCopy",
+			                                 std::bind(&simpleStringTests::insertRemoveCopy, this)));
+
+			// simpleStringBuilder / simpleRope
+			this->addTest(simpleTestFunction("simpleStringTests_builder",
+			                                 std::bind(&simpleStringTests::builder, this)));
+
+			this->addTest(simpleTestFunction("simpleStringTests_ropeEdits",
+			                                 std::bind(&simpleStringTests::ropeEdits, this)));
+
+			// simpleStringView
+			this->addTest(simpleTestFunction("simpleStringTests_splitViewLookup",
+			                                 std::bind(&simpleStringTests::splitViewLookup, this)));
+
+			// Search
+			this->addTest(simpleTestFunction("simpleStringTests_searchAndMatcher",
+			                                 std::bind(&simpleStringTests::searchAndMatcher, this)));
+
+			// Transforms
+			this->addTest(simpleTestFunction("simpleStringTests_replaceAllAndCase",
+			                                 std::bind(&simpleStringTests::replaceAllAndCase, this)));
+
+			// Numbers
+			this->addTest(simpleTestFunction("simpleStringTests_numbers",
+			                                 std::bind(&simpleStringTests::numbers, this)));
+			this->addTest(simpleTestFunction("simpleStringTests_format",
+			                                 std::bind(&simpleStringTests::format, this)));
+
+			// Interning
+			this->addTest(simpleTestFunction("simpleStringTests_poolAtoms",
+			                                 std::bind(&simpleStringTests::poolAtoms, this)));
+
+			// Streaming
+			this->addTest(simpleTestFunction("simpleStringTests_textReader",
+			                                 std::bind(&simpleStringTests::textReader, this)));
+			this->addTest(simpleTestFunction("simpleStringTests_mappedFile",
+			                                 std::bind(&simpleStringTests::mappedFile, this)));
+		}
+
+		~simpleStringTests()
+		{
+		}
+
+		bool smallAndGrowth()
+		{
+			simpleString small("short");
+			int smallCapacity = small.capacity();
+
+			// Appends one character at a time (capacity should only double)
+			simpleString large;
+			int growCount = 0;
+
+			for (int index = 0; index < 10000; index++)
+			{
+				int capacity = large.capacity();
+
+				large.append((char)('a' + index % 26));
+
+				if (large.capacity() != capacity)
+					growCount++;
+			}
+
+			large.append(large);
+
+			this->testAssert("simpleStringTests_smallAndGrowth", [&]()
+			{
+				return smallCapacity == simpleString::SmallCapacity &&
+					   small == "short" &&
+					   large.count() == 20000 &&
+					   large.get(10000) == 'a' &&
+					   large.get(19999) == large.get(9999) &&
+					   growCount < 16;
+			});
+
+			return true;
+		}
+
+		bool insertRemoveCopy()
+		{
+			simpleString text("hello world");
+
+			text.insert(5, ",");
+			text.insert(text.count(), "!");
+			text.remove(0, 1);
+			text.insert(0, "H");
+
+			simpleString copy(text);
+			simpleString assigned;
+
+			assigned = "overwritten by a string that does not fit inline";
+			assigned = copy;
+
+			copy.clear();
+
+			this->testAssert("simpleStringTests_insertRemoveCopy", [&]()
+			{
+				return text == "Hello, world!" &&
+					   assigned == text &&
+					   assigned.getHash() == text.getHash() &&
+					   copy.count() == 0 &&
+					   copy.c_str()[0] == '\0';
+			});
+
+			return true;
+		}
+
+		bool builder()
+		{
+			simpleStringBuilder builder;
+			simpleString line("0123456789");
+
+			// Spans many chunks
+			for (int index = 0; index < 10000; index++)
+				builder.appendLine(line);
+
+			builder.appendPadding('-', 5);
+
+			simpleString result = builder.toString();
+
+			this->testAssert("simpleStringTests_builder", [&]()
+			{
+				return builder.count() == 110005 &&
+					   result.count() == 110005 &&
+					   result.get(10) == '\n' &&
+					   result.get(109999) == '\n' &&
+					   result.get(99998) == '8' &&
+					   result.endsWith("9\n-----");
+			});
+
+			return true;
+		}
+
+		bool ropeEdits()
+		{
+			simpleRope rope("hello world");
+
+			rope.insert(5, simpleString(","));
+			rope.append(simpleString("!"));
+			rope.replace(0, 1, simpleString("H"));
+
+			// Large insert in the middle (several fragments); then removed again
+			simpleString large(5000);
+
+			rope.insert(6, large);
+			rope.remove(6, 5000);
+
+			simpleRope copy(rope);
+
+			copy.remove(0, 7);
+
+			this->testAssert("simpleStringTests_ropeEdits", [&]()
+			{
+				return rope.toString() == "Hello, world!" &&
+					   rope.count() == 13 &&
+					   rope.get(7) == 'w' &&
+					   rope.subString(7, 5) == "world" &&
+					   copy.toString() == "world!";
+			});
+
+			return true;
+		}
+
+		bool splitViewLookup()
+		{
+			simpleString line("id,name,,value");
+			simpleArray<simpleStringView> fields = line.splitView(',');
+
+			// Probe simpleString keys with views (no simpleString is created)
+			simpleHash<simpleString, int> columns;
+
+			columns.add("id", 0);
+			columns.add("name", 1);
+			columns.add("value", 2);
+
+			simpleStringTokenizer tokenizer = line.tokenize(",");
+			simpleStringView token;
+			int tokenCount = 0;
+
+			while (tokenizer.next(token))
+				tokenCount++;
+
+			this->testAssert("simpleStringTests_splitViewLookup", [&]()
+			{
+				return fields.count() == 4 &&
+					   fields.get(2).isEmpty() &&
+					   fields.get(1) == "name" &&
+					   columns.get(fields.get(1)) == 1 &&
+					   columns.get(fields.get(3)) == 2 &&
+					   !columns.contains(fields.get(2)) &&
+					   tokenCount == 3;
+			});
+
+			return true;
+		}
+
+		bool searchAndMatcher()
+		{
+			simpleString text("the cat sat on the mat; the end");
+
+			simpleList<simpleString> patterns;
+
+			patterns.add("the");
+			patterns.add("at");
+			patterns.add("mat");
+
+			simpleStringMatcher matcher(patterns.toArray());
+			simpleList<int> matches;
+
+			// "the" | "at" (cat) | "at" (sat) | "the" | "mat" (longest at its index) | "the"
+			matcher.forEachLeftmostMatch(text, [&matches] (int patternIndex, int index)
+			{
+				matches.add(index);
+				return iterationCallback::iterate;
+			});
+
+			simpleString partial("hello wor");
+
+			this->testAssert("simpleStringTests_searchAndMatcher", [&]()
+			{
+				return text.indexOf("the") == 0 &&
+					   text.indexOf("the", 1) == 15 &&
+					   text.lastIndexOf("the") == 24 &&
+					   text.countOf("at") == 3 &&
+					   partial.search("world") == -1 &&
+					   matches.count() == 6 &&
+					   matches.get(1) == 5 &&
+					   matches.get(4) == 19;
+			});
+
+			return true;
+		}
+
+		bool replaceAllAndCase()
+		{
+			simpleString shorter("{name} and {name}");
+			simpleString longer("{name} and {name}");
+
+			int shorterCount = shorter.replaceAll("{name}", "Al");
+			int longerCount = longer.replaceAll("{name}", "Alexander");
+
+			simpleString text("  Mixed Case Text, 123  ");
+
+			text.trim();
+
+			simpleString upper(text);
+			simpleString lower(text);
+
+			upper.toUpperInPlace();
+			lower.toLowerInPlace();
+
+			this->testAssert("simpleStringTests_replaceAllAndCase", [&]()
+			{
+				return shorterCount == 2 &&
+					   longerCount == 2 &&
+					   shorter == "Al and Al" &&
+					   longer == "Alexander and Alexander" &&
+					   text == "Mixed Case Text, 123" &&
+					   upper == "MIXED CASE TEXT, 123" &&
+					   lower == "mixed case text, 123";
+			});
+
+			return true;
+		}
+
+		bool numbers()
+		{
+			simpleString text;
+
+			text.appendNumber(0.1);
+			text.append(',');
+			text.appendNumber(-42);
+			text.append(',');
+			text.appendNumber(1e300);
+
+			double value = 0;
+			int intValue = 0;
+
+			bool parsed = simpleString(" 0.1 ").tryParse(value);
+			bool rejected = !simpleString("12abc").tryToInt(intValue);
+
+			simpleArray<float> points = simpleNumber::parseDelimited<float>("1 2 3\n4.5 5 6\n", " \r\n");
+
+			simpleList<int> fields;
+			int errorIndex = -1;
+
+			bool badField = !simpleNumber::tryParseDelimited<int>("1,2,x3", ",", fields, errorIndex);
+
+			this->testAssert("simpleStringTests_numbers", [&]()
+			{
+				return text == "0.1,-42,1e+300" &&
+					   parsed && value == 0.1 &&
+					   rejected &&
+					   points.count() == 6 &&
+					   points.get(3) == 4.5f &&
+					   badField && errorIndex == 4;
+			});
+
+			return true;
+		}
+
+		bool format()
+		{
+			std::string text = simpleExt::format("{} {:>5} {:<4}| {:08.3f} {:x} {{{}}}", "id", 42, 'c', -3.14159, 255, simpleString("s"));
+
+			char buffer[8];
+			int length = simpleFormat::formatTo(buffer, 8, "{}-{}", 12345, 67890);
+
+			simpleStringBuilder builder;
+
+			simpleFormat::formatTo(builder, "{:.1f},{:X}", 2.0, 48879);
+
+			this->testAssert("simpleStringTests_format", [&]()
+			{
+				return text == "id    42 c   | -003.142 ff {s}" &&
+					   length == 11 &&
+					   std::string(buffer) == "12345-6" &&
+					   builder.toString() == "2.0,BEEF";
+			});
+
+			return true;
+		}
+
+		bool poolAtoms()
+		{
+			simpleStringPool pool;
+			simpleHash<simpleAtom, int> table;
+
+			for (int index = 0; index < 1000; index++)
+			{
+				simpleString name("symbol");
+
+				name.appendNumber(index);
+
+				table.add(pool.intern(name), index);
+			}
+
+			simpleString name("symbol42");
+
+			simpleAtom first = pool.intern(name);
+			simpleAtom second = pool.intern("symbol42");
+			simpleAtom missing;
+
+			bool found = pool.tryGet("symbol999", missing);
+			bool notFound = !pool.tryGet("symbol1000", missing);
+
+			// Seeded hashes (simpleHashStdCore):  Atoms hash their characters with the seed
+			simpleHashStdCore<simpleAtom, int> seededTable;
+
+			seededTable.add(first, 42);
+
+			this->testAssert("simpleStringTests_poolAtoms", [&]()
+			{
+				return pool.count() == 1000 &&
+					   first == second &&
+					   first.c_str() == second.c_str() &&
+					   first.getView() == name &&
+					   first.getHash() == name.getHash() &&
+					   first.getHash(7) == name.getHash(7) &&
+					   first.getHash(7) != first.getHash(8) &&
+					   simpleHashStdKey::seededHash(first) == simpleHashStdKey::seededHash(name) &&
+					   seededTable.get(second) == 42 &&
+					   table.get(second) == 42 &&
+					   found && notFound;
+			});
+
+			return true;
+		}
+
+		bool textReader()
+		{
+			const char* filename = "simpleStringTests_textReader.txt";
+
+			simpleFileIO::writeTextFile(filename, simpleString("x,y,z\n1,2,3\n\ncaf\xC3\xA9,\xE2\x82\xAC,last"));
+
+			simpleList<simpleStringView> fields;
+			simpleStringView line;
+
+			bool header, values, empty, utf8, end;
+
+			// (Closed before the file is removed)
+			{
+				// (Small buffer:  Lines cross block reads)
+				simpleTextReader reader(filename, true, 4);
+
+				header = reader.readFields(',', fields) && fields.count() == 3 && fields.get(2) == "z";
+				values = reader.readFields(',', fields) && fields.get(1) == "2";
+				empty = reader.readLine(line) && line.isEmpty();
+				utf8 = reader.readFields(',', fields) && simpleUtf8::countCodePoints(fields.get(0)) == 4 && fields.get(2) == "last";
+				end = !reader.readLine(line) && reader.getLineNumber() == 4;
+			}
+
+			int lineCount = 0;
+
+			simpleFileIO::forEachLine(filename, [&lineCount](const simpleStringView& line, int lineNumber)
+			{
+				lineCount = lineNumber;
+				return iterationCallback::iterate;
+			});
+
+			std::remove(filename);
+
+			this->testAssert("simpleStringTests_textReader", [&]()
+			{
+				return header && values && empty && utf8 && end && lineCount == 4;
+			});
+
+			return true;
+		}
+
+		bool mappedFile()
+		{
+			const char* filename = "simpleStringTests_mappedFile.bin";
+
+			// Binary content:  new lines, nulls, and high bytes
+			const char content[] = { 'B', 'M', '\n', '\0', (char)0xFF, '\r', '\n', 'z' };
+
+			{
+				std::ofstream stream(filename, std::ios::out | std::ios::binary);
+
+				stream.write(content, sizeof(content));
+			}
+
+			size_t mappedSize, bufferedSize;
+			bool mappedEqual, bufferedEqual;
+
+			{
+				simpleMappedFile mapped(filename);
+
+				mapped.advise(simpleMappedFileAccess::Sequential);
+
+				simpleBuffer view = mapped.getBuffer();
+
+				mappedSize = view.getBufferSize();
+				mappedEqual = std::memcmp(view.getBuffer(), content, sizeof(content)) == 0;
+			}
+
+			simpleBuffer* buffered = simpleFileIO::bufferFile(filename);
+
+			bufferedSize = buffered->getBufferSize();
+			bufferedEqual = std::memcmp(buffered->getBuffer(), content, sizeof(content)) == 0;
+
+			delete[] buffered->getBuffer();
+			delete buffered;
+
+			std::remove(filename);
+
+			this->testAssert("simpleStringTests_mappedFile", [&]()
+			{
+				return mappedSize == sizeof(content) && mappedEqual &&
+					   bufferedSize == sizeof(content) && bufferedEqual;
+			});
+
+			return true;
+		}
+	};
+}